@@ -61,3 +61,11 @@
 #define STARTUP_SONG SONG(NO_SOUND)
 #endif  // AUDIO_ENABLE
 
+
+#ifdef AUTOCORRECTION_LOADABLE
+// Room in EEPROM for an uploaded autocorrection table and its 8-byte header.
+// The board's EEPROM (e.g. WEAR_LEVELING_LOGICAL_SIZE) must fit it as well.
+#ifndef EECONFIG_USER_DATA_SIZE
+#define EECONFIG_USER_DATA_SIZE 4096
+#endif  // EECONFIG_USER_DATA_SIZE
+#endif  // AUTOCORRECTION_LOADABLE
@@ -22,6 +22,16 @@
 
 #include "achordion.h"
 
+#include "deadlines.h"
+
+#ifdef KEYCODE_CLASS_ENABLE
+#include "keycode_class.h"
+#endif  // KEYCODE_CLASS_ENABLE
+
+#ifdef HANDEDNESS_ENABLE
+#include "handedness.h"
+#endif  // HANDEDNESS_ENABLE
+
 #pragma message \
     "Achordion has evolved into core QMK feature Chordal Hold! To use it, update your QMK set up and see https://docs.qmk.fm/tap_hold#chordal-hold"
 
@@ -31,65 +41,158 @@
 #error "achordion: QMK version is too old to build. Please update QMK."
 #else
 
-// Copy of the `record` and `keycode` args for the current active tap-hold key.
-static keyrecord_t tap_hold_record;
-static uint16_t tap_hold_keycode = KC_NO;
-// Timeout timer. When it expires, the key is considered held.
-static uint16_t hold_timer = 0;
-// Eagerly applied mods, if any.
-static uint8_t eager_mods = 0;
-// Flag to determine whether another key is pressed within the timeout.
-static bool pressed_another_key_before_release = false;
-
-#ifdef ACHORDION_STREAK
-// Timer for typing streak
-static uint16_t streak_timer = 0;
-#else
-// When disabled, is_streak is never true
-#define is_streak false
-#endif
+// Max number of tap-hold keys tracked at once. Keys settled as tapped stop
+// being tracked, so this limits the unsettled and held keys.
+#ifndef ACHORDION_MAX_KEYS
+#define ACHORDION_MAX_KEYS 4
+#endif  // ACHORDION_MAX_KEYS
 
-// Achordion's current state.
+// State of a tracked tap-hold key.
 enum {
-  // A tap-hold key is pressed, but hasn't yet been settled as tapped or held.
+  // The key is pressed, but hasn't yet been settled as tapped or held.
   STATE_UNSETTLED,
-  // Achordion is inactive.
-  STATE_RELEASED,
-  // Active tap-hold key has been settled as tapped.
+  // The key has been settled as tapped.
   STATE_TAPPING,
-  // Active tap-hold key has been settled as held.
+  // The key has been settled as held.
   STATE_HOLDING,
-  // This state is set while calling `process_record()`, which will recursively
-  // call `process_achordion()`. This state is checked so that we don't process
-  // events generated by Achordion and potentially create an infinite loop.
-  STATE_RECURSING,
 };
-static uint8_t achordion_state = STATE_RELEASED;
+
+// A tap-hold key that Achordion tracks from its press until its release.
+typedef struct {
+  // Copy of the `record` and `keycode` args from the key's press event.
+  keyrecord_t record;
+  uint16_t keycode;
+  // Timeout timer. When it expires, the key is considered held.
+  uint16_t hold_timer;
+  // Eagerly applied mods, if any.
+  uint8_t eager_mods;
+  uint8_t state;
+  // Whether the key was pressed while an earlier key was unsettled.
+  bool rolled;
+} tap_hold_t;
+
+// Tracked keys in order of press. Keys are settled oldest first, so that the
+// unsettled keys come after all settled keys.
+static tap_hold_t keys[ACHORDION_MAX_KEYS];
+static uint8_t num_keys = 0;
+// Bitmap by matrix position of keys that were settled as tapped and are still
+// pressed, whose release is to be blocked.
+static uint8_t tapped_keys[(MATRIX_ROWS * MATRIX_COLS + 7) / 8] = {0};
+// This is set while calling `process_record()`, which will recursively call
+// `process_achordion()`. This is checked so that we don't process events
+// generated by Achordion and potentially create an infinite loop.
+static bool recursing = false;
+
+#if TAP_CODE_DELAY > 0
+// Releases of keys settled as tapped, which are plumbed TAP_CODE_DELAY ms after
+// the tap press from achordion_task(), rather than blocking in between.
+static keyrecord_t pending_releases[ACHORDION_MAX_KEYS];
+static uint8_t num_pending_releases = 0;
+static uint16_t release_timer = 0;
+#endif  // TAP_CODE_DELAY > 0
+
+// Index of the first unsettled key, or `num_keys` if there is none.
+static uint8_t first_unsettled(void) {
+  uint8_t i = 0;
+  while (i < num_keys && keys[i].state != STATE_UNSETTLED) {
+    ++i;
+  }
+  return i;
+}
+
+#ifdef ACHORDION_STREAK
+#define MAX_STREAK_TIMEOUT 800
+// Timer for typing streak
+static uint16_t streak_timer = 0;
+#endif
+
+// Sets the deadline for achordion_task() to the soonest hold timeout or
+// streak expiry. Deadlines left by keys settled in the meantime are harmless.
+static void set_task_deadline(void) {
+  bool pending = false;
+  uint16_t next = 0;
+  for (uint8_t i = first_unsettled(); i < num_keys; ++i) {
+    if (!pending || !timer_expired(keys[i].hold_timer, next)) {
+      next = keys[i].hold_timer;
+      pending = true;
+    }
+  }
+#if TAP_CODE_DELAY > 0
+  if (num_pending_releases &&
+      (!pending || !timer_expired(release_timer, next))) {
+    next = release_timer;
+    pending = true;
+  }
+#endif  // TAP_CODE_DELAY > 0
+#ifdef ACHORDION_STREAK
+  if (streak_timer) {
+    const uint16_t streak_end = streak_timer + MAX_STREAK_TIMEOUT;
+    if (!pending || !timer_expired(streak_end, next)) {
+      next = streak_end;
+      pending = true;
+    }
+  }
+#endif
+  if (pending) {
+    deadline_set(achordion_task, next);
+  }
+}
 
 #ifdef ACHORDION_STREAK
 static void update_streak_timer(uint16_t keycode, keyrecord_t* record) {
   if (achordion_streak_continue(keycode)) {
     // We use 0 to represent an unset timer, so `| 1` to force a nonzero value.
     streak_timer = record->event.time | 1;
+    set_task_deadline();
   } else {
     streak_timer = 0;
   }
 }
+
+// Whether pressing `keycode` continues a typing streak, so that `key` should
+// be settled as tapped.
+static bool is_streak(const tap_hold_t* key, uint16_t keycode,
+                      keyrecord_t* record) {
+  const uint16_t s_timeout =
+      achordion_streak_chord_timeout(key->keycode, keycode);
+  return streak_timer && s_timeout &&
+         !timer_expired(record->event.time, (streak_timer + s_timeout));
+}
+#else
+// When disabled, is_streak is never true
+#define is_streak(key, keycode, record) false
 #endif
 
-// Presses or releases eager_mods through process_action(), which skips the
-// usual event handling pipeline. The action is considered as a mod-tap hold or
-// release, with Retro Tapping if enabled.
-static void process_eager_mods_action(void) {
+// Presses or releases the key's eager_mods through process_action(), which
+// skips the usual event handling pipeline. The action is considered as a
+// mod-tap hold or release, with Retro Tapping if enabled.
+static void process_eager_mods_action(tap_hold_t* key) {
   action_t action;
   action.code = ACTION_MODS_TAP_KEY(
-      eager_mods, QK_MOD_TAP_GET_TAP_KEYCODE(tap_hold_keycode));
-  process_action(&tap_hold_record, action);
+      key->eager_mods, QK_MOD_TAP_GET_TAP_KEYCODE(key->keycode));
+  process_action(&key->record, action);
+}
+
+// Releases the key's eager_mods, if any. To avoid falsely triggering Retro
+// Tapping, they are released as regular mods rather than a mod-tap.
+static void clear_eager_mods(tap_hold_t* key) {
+  if (key->eager_mods) {
+#if defined(RETRO_TAPPING) || defined(RETRO_TAPPING_PER_KEY)
+#ifdef DUMMY_MOD_NEUTRALIZER_KEYCODE
+    neutralize_flashing_modifiers(get_mods());
+#endif  // DUMMY_MOD_NEUTRALIZER_KEYCODE
+#endif  // defined(RETRO_TAPPING) || defined(RETRO_TAPPING_PER_KEY)
+    key->record.event.pressed = false;
+    action_t action;
+    action.code = ACTION_MODS(key->eager_mods);
+    process_action(&key->record, action);
+    key->eager_mods = 0;
+  }
 }
 
-// Calls `process_record()` with state set to RECURSING.
-static void recursively_process_record(keyrecord_t* record, uint8_t state) {
-  achordion_state = STATE_RECURSING;
+// Calls `process_record()` with `recursing` set.
+static void recursively_process_record(keyrecord_t* record) {
+  recursing = true;
 #if defined(POINTING_DEVICE_ENABLE) && defined(POINTING_DEVICE_AUTO_MOUSE_ENABLE)
   int8_t mouse_key_tracker = get_auto_mouse_key_tracker();
 #endif
@@ -97,225 +200,319 @@ static void recursively_process_record(keyrecord_t* record, uint8_t state) {
 #if defined(POINTING_DEVICE_ENABLE) && defined(POINTING_DEVICE_AUTO_MOUSE_ENABLE)
   set_auto_mouse_key_tracker(mouse_key_tracker);
 #endif
-  achordion_state = state;
+  recursing = false;
 }
 
-// Sends hold press event and settles the active tap-hold key as held.
-static void settle_as_hold(void) {
-  if (eager_mods) {
+#if TAP_CODE_DELAY > 0
+// Plumbs the pending tap releases, oldest first.
+static void release_pending_taps(void) {
+  for (uint8_t i = 0; i < num_pending_releases; ++i) {
+    dprintln("Achordion: Plumbing tap release.");
+    recursively_process_record(&pending_releases[i]);
+  }
+  num_pending_releases = 0;
+}
+#endif  // TAP_CODE_DELAY > 0
+
+// Sends hold press event and settles the key as held.
+static void settle_as_hold(tap_hold_t* key) {
+  key->state = STATE_HOLDING;
+  if (key->eager_mods) {
     // If eager mods are being applied, nothing needs to be done besides
     // updating the state.
     dprintln("Achordion: Settled eager mod as hold.");
-    achordion_state = STATE_HOLDING;
   } else {
     // Create hold press event.
     dprintln("Achordion: Plumbing hold press.");
-    recursively_process_record(&tap_hold_record, STATE_HOLDING);
+    recursively_process_record(&key->record);
   }
 }
 
-// Sends tap press and release and settles the active tap-hold key as tapped.
-static void settle_as_tap(void) {
-  if (eager_mods) {  // Clear eager mods if set.
-#if defined(RETRO_TAPPING) || defined(RETRO_TAPPING_PER_KEY)
-#ifdef DUMMY_MOD_NEUTRALIZER_KEYCODE
-    neutralize_flashing_modifiers(get_mods());
-#endif  // DUMMY_MOD_NEUTRALIZER_KEYCODE
-#endif  // defined(RETRO_TAPPING) || defined(RETRO_TAPPING_PER_KEY)
-    tap_hold_record.event.pressed = false;
-    // To avoid falsely triggering Retro Tapping, process eager mods release as
-    // a regular mods release rather than a mod-tap release.
-    action_t action;
-    action.code = ACTION_MODS(eager_mods);
-    process_action(&tap_hold_record, action);
-    eager_mods = 0;
+// Sends tap press and release and settles the i-th key as tapped.
+static void settle_as_tap(uint8_t i) {
+  tap_hold_t* key = &keys[i];
+  // Keys pressed after this one are unsettled, so their eager mods must not
+  // apply to the tap.
+  for (uint8_t j = i + 1; j < num_keys; ++j) {
+    clear_eager_mods(&keys[j]);
   }
+  clear_eager_mods(key);
+  key->state = STATE_TAPPING;
 
   dprintln("Achordion: Plumbing tap press.");
-  tap_hold_record.event.pressed = true;
-  tap_hold_record.tap.count = 1;  // Revise event as a tap.
-  tap_hold_record.tap.interrupted = true;
+  key->record.event.pressed = true;
+  key->record.tap.count = 1;  // Revise event as a tap.
+  key->record.tap.interrupted = true;
   // Plumb tap press event.
-  recursively_process_record(&tap_hold_record, STATE_TAPPING);
+  recursively_process_record(&key->record);
 
-  send_keyboard_report();
+  key->record.event.pressed = false;
 #if TAP_CODE_DELAY > 0
-  wait_ms(TAP_CODE_DELAY);
-#endif  // TAP_CODE_DELAY > 0
-
+  // Let the tap press be sent now, and defer the release so that the key that
+  // settled this one is handled without waiting.
+  if (!num_pending_releases) {
+    release_timer = timer_read() + TAP_CODE_DELAY;
+  }
+  pending_releases[num_pending_releases++] = key->record;
+  set_task_deadline();
+#else
   dprintln("Achordion: Plumbing tap release.");
-  tap_hold_record.event.pressed = false;
   // Plumb tap release event.
-  recursively_process_record(&tap_hold_record, STATE_TAPPING);
+  recursively_process_record(&key->record);
+#endif  // TAP_CODE_DELAY > 0
+}
+
+// Bit index and mask in `tapped_keys` of the key at `pos`.
+#define TAPPED_KEY_INDEX(pos) (((pos).row * MATRIX_COLS + (pos).col) / 8)
+#define TAPPED_KEY_MASK(pos) (1 << (((pos).row * MATRIX_COLS + (pos).col) % 8))
+
+// Stops tracking keys settled as tapped, freeing their slots for new keys.
+// Their releases are blocked by position instead.
+static void untrack_tapped_keys(void) {
+  uint8_t n = 0;
+  for (uint8_t i = 0; i < num_keys; ++i) {
+    if (keys[i].state == STATE_TAPPING) {
+      const keypos_t pos = keys[i].record.event.key;
+      tapped_keys[TAPPED_KEY_INDEX(pos)] |= TAPPED_KEY_MASK(pos);
+    } else {
+      keys[n++] = keys[i];
+    }
+  }
+  num_keys = n;
+}
+
+// Starts tracking a tap-hold key that QMK considers held.
+static void track_key(uint16_t keycode, keyrecord_t* record,
+                      uint16_t timeout) {
+  tap_hold_t* key = &keys[num_keys];
+  key->rolled = first_unsettled() < num_keys;
+  ++num_keys;
+  key->keycode = keycode;
+  key->record = *record;
+  key->hold_timer = record->event.time + timeout;
+  key->eager_mods = 0;
+  key->state = STATE_UNSETTLED;
+  set_task_deadline();
+
+  if (IS_QK_MOD_TAP(keycode)) {  // Apply mods immediately if they are "eager."
+    const uint8_t mod = mod_config(QK_MOD_TAP_GET_MODS(keycode));
+    if (
+#if defined(CAPS_WORD_ENABLE)
+        // Since eager mods bypass normal event handling, Caps Word does not
+        // work as expected with eager Shift. So we don't apply Shift eagerly
+        // while Caps Word is on.
+        !(is_caps_word_on() && (mod & MOD_LSFT) != 0) &&
+#endif  // defined(CAPS_WORD_ENABLE)
+        achordion_eager_mod(mod)) {
+      key->eager_mods = mod;
+      process_eager_mods_action(key);
+    }
+  }
+
+  dprintf("Achordion: Key 0x%04X pressed.%s\n", keycode,
+          key->eager_mods ? " Set eager mods." : "");
+}
+
+// Handles the release of the i-th key and stops tracking it.
+static void release_key(uint8_t i) {
+  tap_hold_t* key = &keys[i];
+
+  if (key->state == STATE_UNSETTLED && (key->rolled || i + 1 < num_keys)) {
+    // Other tap-hold keys were pressed while this key was held, but not
+    // another key to settle them, as in a roll through several home row mods.
+    // This key and the keys pressed before it weren't chorded with the keys
+    // that followed, so settle them as tapped.
+    dprintln("Achordion: Key released in a roll.");
+    for (uint8_t j = first_unsettled(); j <= i; ++j) {
+      settle_as_tap(j);
+#ifdef ACHORDION_STREAK
+      update_streak_timer(keys[j].keycode, &keys[j].record);
+#endif
+    }
+  }
+
+  if (key->eager_mods) {
+    dprintln("Achordion: Key released. Clearing eager mods.");
+    key->record.event.pressed = false;
+    process_eager_mods_action(key);
+  } else if (key->state == STATE_HOLDING) {
+    dprintln("Achordion: Key released. Plumbing hold release.");
+    key->record.event.pressed = false;
+    // Plumb hold release event.
+    recursively_process_record(&key->record);
+  } else if (key->state == STATE_UNSETTLED) {
+    // No other key was pressed between the press and release of the tap-hold
+    // key, plumb a hold press and then a release.
+    dprintln("Achordion: Key released. Plumbing hold press and release.");
+    recursively_process_record(&key->record);
+    key->record.event.pressed = false;
+    recursively_process_record(&key->record);
+  } else {
+    dprintln("Achordion: Key released.");
+  }
+
+  --num_keys;
+  memmove(key, key + 1, (num_keys - i) * sizeof(tap_hold_t));
 }
 
 bool process_achordion(uint16_t keycode, keyrecord_t* record) {
   // Don't process events that Achordion generated.
-  if (achordion_state == STATE_RECURSING) {
+  if (recursing) {
     return true;
   }
+#if TAP_CODE_DELAY > 0
+  // Release pending taps before this event, so that events stay in order.
+  release_pending_taps();
+#endif  // TAP_CODE_DELAY > 0
 
   // Determine whether the current event is for a mod-tap or layer-tap key.
-  const bool is_mt = IS_QK_MOD_TAP(keycode);
-  const bool is_tap_hold = is_mt || IS_QK_LAYER_TAP(keycode);
+  const bool is_tap_hold = IS_QK_MOD_TAP(keycode) || IS_QK_LAYER_TAP(keycode);
   // Check that this is a normal key event, don't act on combos.
   const bool is_key_event = IS_KEYEVENT(record->event);
 
-  // Event while no tap-hold key is active.
-  if (achordion_state == STATE_RELEASED) {
-    if (is_tap_hold && record->tap.count == 0 && record->event.pressed &&
-        is_key_event) {
-      // A tap-hold key is pressed and considered by QMK as "held".
-      const uint16_t timeout = achordion_timeout(keycode);
-      if (timeout > 0) {
-        achordion_state = STATE_UNSETTLED;
-        // Save info about this key.
-        tap_hold_keycode = keycode;
-        tap_hold_record = *record;
-        hold_timer = record->event.time + timeout;
-        pressed_another_key_before_release = false;
-        eager_mods = 0;
-
-        if (is_mt) {  // Apply mods immediately if they are "eager."
-          const uint8_t mod = mod_config(QK_MOD_TAP_GET_MODS(keycode));
-          if (
-#if defined(CAPS_WORD_ENABLE)
-              // Since eager mods bypass normal event handling, Caps Word does
-              // not work as expected with eager Shift. So we don't apply Shift
-              // eagerly while Caps Word is on.
-              !(is_caps_word_on() && (mod & MOD_LSFT) != 0) &&
-#endif  // defined(CAPS_WORD_ENABLE)
-              achordion_eager_mod(mod)) {
-            eager_mods = mod;
-            process_eager_mods_action();
-          }
-        }
-
-        dprintf("Achordion: Key 0x%04X pressed.%s\n", keycode,
-                eager_mods ? " Set eager mods." : "");
-        return false;  // Skip default handling.
+  if (!record->event.pressed) {
+    // Release of a tracked tap-hold key.
+    for (uint8_t i = 0; i < num_keys; ++i) {
+      if (keys[i].keycode == keycode) {
+        release_key(i);
+        return false;
+      }
+    }
+    // Release of a key that was settled as tapped and untracked.
+    if (is_key_event) {
+      const keypos_t pos = record->event.key;
+      uint8_t* tapped = &tapped_keys[TAPPED_KEY_INDEX(pos)];
+      if (*tapped & TAPPED_KEY_MASK(pos)) {
+        *tapped &= ~TAPPED_KEY_MASK(pos);
+        dprintln("Achordion: Key released.");
+        return false;
       }
     }
-
 #ifdef ACHORDION_STREAK
     update_streak_timer(keycode, record);
 #endif
-    return true;  // Otherwise, continue with default handling.
-  } else if (record->event.pressed && tap_hold_keycode != keycode) {
-    // Track whether another key was pressed while using a tap-hold key.
-    pressed_another_key_before_release = true;
+    return true;
   }
 
-  // Release of the active tap-hold key.
-  if (keycode == tap_hold_keycode && !record->event.pressed) {
-    if (eager_mods) {
-      dprintln("Achordion: Key released. Clearing eager mods.");
-      tap_hold_record.event.pressed = false;
-      process_eager_mods_action();
-    } else if (achordion_state == STATE_HOLDING) {
-      dprintln("Achordion: Key released. Plumbing hold release.");
-      tap_hold_record.event.pressed = false;
-      // Plumb hold release event.
-      recursively_process_record(&tap_hold_record, STATE_RELEASED);
-    } else if (!pressed_another_key_before_release) {
-      // No other key was pressed between the press and release of the tap-hold
-      // key, plumb a hold press and then a release.
-      dprintln("Achordion: Key released. Plumbing hold press and release.");
-      recursively_process_record(&tap_hold_record, STATE_HOLDING);
-      tap_hold_record.event.pressed = false;
-      recursively_process_record(&tap_hold_record, STATE_RELEASED);
-    } else {
-      dprintln("Achordion: Key released.");
+  // Whether a tap-hold key is pressed and considered by QMK as "held".
+  const bool is_held_tap_hold =
+      is_tap_hold && record->tap.count == 0 && is_key_event;
+  const uint16_t timeout = is_held_tap_hold ? achordion_timeout(keycode) : 0;
+  uint8_t i = first_unsettled();
+  bool settled = false;
+
+  if (timeout > 0) {
+    // Another tap-hold key is pressed while keys are unsettled. Settle keys as
+    // held where `achordion_chord()` says so, like a home row mod with one on
+    // the other hand. Keys are settled in order, so the first key that the
+    // chord doesn't settle, e.g. in a roll on one hand, and the keys after it
+    // are left to be settled by the next key.
+    for (; i < num_keys; ++i, settled = true) {
+      if (is_streak(&keys[i], keycode, record)) {
+        settle_as_tap(i);
+#ifdef ACHORDION_STREAK
+        update_streak_timer(keys[i].keycode, &keys[i].record);
+#endif
+      } else if (achordion_chord(keys[i].keycode, &keys[i].record, keycode,
+                                 record)) {
+        settle_as_hold(&keys[i]);
+      } else {
+        break;
+      }
     }
 
-    achordion_state = STATE_RELEASED;
-    tap_hold_keycode = KC_NO;
-    return false;
+    untrack_tapped_keys();
+    if (num_keys < ACHORDION_MAX_KEYS) {
+      track_key(keycode, record, timeout);
+      return false;  // Skip default handling.
+    }
+    dprintln("Achordion: Too many keys. Settling as held.");
   }
 
-  if (achordion_state == STATE_UNSETTLED && record->event.pressed) {
-#ifdef ACHORDION_STREAK
-    const uint16_t s_timeout =
-        achordion_streak_chord_timeout(tap_hold_keycode, keycode);
-    const bool is_streak =
-        streak_timer && s_timeout &&
-        !timer_expired(record->event.time, (streak_timer + s_timeout));
-#endif
-
-    // Press event occurred on a key other than the active tap-hold key.
-
-    // If the other key is *also* a tap-hold key and considered by QMK to be
-    // held, then we settle the active key as held. This way, things like
-    // chording multiple home row modifiers will work, but let's our logic
-    // consider simply a single tap-hold key as "active" at a time.
-    //
-    // Otherwise, we call `achordion_chord()` to determine whether to settle the
-    // tap-hold key as tapped vs. held. We implement the tap or hold by plumbing
-    // events back into the handling pipeline so that QMK features and other
-    // user code can see them. This is done by calling `process_record()`, which
-    // in turn calls most handlers including `process_record_user()`.
-    if (!is_streak &&
-        (!is_key_event || (is_tap_hold && record->tap.count == 0) ||
-         achordion_chord(tap_hold_keycode, &tap_hold_record, keycode,
+  // Press event occurred on a key other than the tracked tap-hold keys.
+  //
+  // We call `achordion_chord()` to determine whether to settle each unsettled
+  // key as tapped vs. held, oldest first. If the other key is *also* a
+  // tap-hold key and considered by QMK to be held (but not tracked), then we
+  // settle the keys as held. We implement the tap or hold by plumbing events
+  // back into the handling pipeline so that QMK features and other user code
+  // can see them. This is done by calling `process_record()`, which in turn
+  // calls most handlers including `process_record_user()`.
+  bool tapped = false;
+  for (; i < num_keys; ++i, settled = true) {
+    if (!is_streak(&keys[i], keycode, record) &&
+        (!is_key_event || is_held_tap_hold ||
+         achordion_chord(keys[i].keycode, &keys[i].record, keycode,
                          record))) {
-      settle_as_hold();
+      settle_as_hold(&keys[i]);
 
 #ifdef REPEAT_KEY_ENABLE
       // Edge case involving LT + Repeat Key: in a sequence of "LT down, other
       // down" where "other" is on the other layer in the same position as
       // Repeat or Alternate Repeat, the repeated keycode is set instead of the
       // one on the switched-to layer. Here we correct that.
-      if (get_repeat_key_count() != 0 && IS_QK_LAYER_TAP(tap_hold_keycode)) {
+      if (get_repeat_key_count() != 0 && IS_QK_LAYER_TAP(keys[i].keycode)) {
         record->keycode = KC_NO;  // Forget the repeated keycode.
         clear_weak_mods();
       }
 #endif  // REPEAT_KEY_ENABLE
     } else {
-      settle_as_tap();
-
-#ifdef ACHORDION_STREAK
-      update_streak_timer(keycode, record);
-      if (is_streak && is_key_event && is_tap_hold && record->tap.count == 0) {
-        // If we are in a streak and resolved the current tap-hold key as a tap
-        // consider the next tap-hold key as active to be resolved next.
-        update_streak_timer(tap_hold_keycode, &tap_hold_record);
-        const uint16_t timeout = achordion_timeout(keycode);
-        tap_hold_keycode = keycode;
-        tap_hold_record = *record;
-        hold_timer = record->event.time + timeout;
-        achordion_state = STATE_UNSETTLED;
-        pressed_another_key_before_release = false;
-        return false;
-      }
-#endif
+      settle_as_tap(i);
+      tapped = true;
     }
-
-    recursively_process_record(record, achordion_state);  // Re-process event.
-    return false;  // Block the original event.
   }
 
 #ifdef ACHORDION_STREAK
-  // update idle timer on regular keys event
-  update_streak_timer(keycode, record);
+  if (!settled || tapped) {
+    // update idle timer on regular keys event
+    update_streak_timer(keycode, record);
+  }
+#else
+  (void)tapped;
 #endif
-  return true;
+
+  if (!settled) {
+    return true;  // Otherwise, continue with default handling.
+  }
+  recursively_process_record(record);  // Re-process event.
+  return false;  // Block the original event.
 }
 
 void achordion_task(void) {
-  if (achordion_state == STATE_UNSETTLED &&
-      timer_expired(timer_read(), hold_timer)) {
-    settle_as_hold();  // Timeout expired, settle the key as held.
+#if TAP_CODE_DELAY > 0
+  if (num_pending_releases && timer_expired(timer_read(), release_timer)) {
+    release_pending_taps();
+  }
+#endif  // TAP_CODE_DELAY > 0
+  // When a key's timeout expires, settle it as held, along with any unsettled
+  // keys pressed before it.
+  const uint8_t first = first_unsettled();
+  uint8_t end = first;
+  for (uint8_t i = first; i < num_keys; ++i) {
+    if (timer_expired(timer_read(), keys[i].hold_timer)) {
+      end = i + 1;
+    }
+  }
+  for (uint8_t i = first; i < end; ++i) {
+    settle_as_hold(&keys[i]);
   }
 
 #ifdef ACHORDION_STREAK
-#define MAX_STREAK_TIMEOUT 800
   if (streak_timer &&
       timer_expired(timer_read(), (streak_timer + MAX_STREAK_TIMEOUT))) {
     streak_timer = 0;  // Expired.
   }
 #endif
+  set_task_deadline();
 }
 
+#ifdef HANDEDNESS_ENABLE
+bool achordion_opposite_hands(const keyrecord_t* tap_hold_record,
+                              const keyrecord_t* other_record) {
+  return !handedness_same_hand(tap_hold_record->event.key,
+                               other_record->event.key);
+}
+#else
 // Returns true if `pos` on the left hand of the keyboard, false if right.
 static bool on_left_hand(keypos_t pos) {
 #ifdef SPLIT_KEYBOARD
@@ -331,6 +528,7 @@ bool achordion_opposite_hands(const keyrecord_t* tap_hold_record,
   return on_left_hand(tap_hold_record->event.key) !=
          on_left_hand(other_record->event.key);
 }
+#endif  // HANDEDNESS_ENABLE
 
 // By default, use the BILATERAL_COMBINATIONS rule to consider the tap-hold key
 // "held" only when it and the other key are on opposite hands.
@@ -360,6 +558,9 @@ __attribute__((weak)) bool achordion_streak_continue(uint16_t keycode) {
   if (IS_QK_MOD_TAP(keycode)) keycode = QK_MOD_TAP_GET_TAP_KEYCODE(keycode);
   if (IS_QK_LAYER_TAP(keycode)) keycode = QK_LAYER_TAP_GET_TAP_KEYCODE(keycode);
   // Regular letters and punctuation continue the streak.
+#ifdef KEYCODE_CLASS_ENABLE
+  return keycode <= 0xff && (get_keycode_class(keycode, 0) & KCC_STREAK) != 0;
+#else
   if (keycode >= KC_A && keycode <= KC_Z) return true;
   switch (keycode) {
     case KC_DOT:
@@ -370,6 +571,7 @@ __attribute__((weak)) bool achordion_streak_continue(uint16_t keycode) {
   }
   // All other keys end the streak
   return false;
+#endif  // KEYCODE_CLASS_ENABLE
 }
 
 __attribute__((weak)) uint16_t achordion_streak_chord_timeout(
@@ -39,6 +39,21 @@
  * Achordion only changes the behavior when QMK considered the key held. It
  * changes some would-be holds to taps, but no taps to holds.
  *
+ * Several tap-hold keys may be unsettled at once, up to `ACHORDION_MAX_KEYS`
+ * (default 4), each with its own timeout and eager mods. When another
+ * tap-hold key is pressed, the unsettled keys that `achordion_chord()` holds
+ * with it are settled as held. The rest wait, since the new key might be
+ * chorded with them or rolled after them; they are settled one by one by the
+ * next other key, or as tapped if released first, as in a roll. With
+ * `ACHORDION_MAX_KEYS` set to 1, a tap-hold key pressed while another is
+ * unsettled settles that one as held. Keys settled as tapped don't count
+ * toward the limit, even while still pressed.
+ *
+ * When a key is settled as tapped, its tap press is sent right away, and its
+ * release `TAP_CODE_DELAY` ms later from `achordion_task()`, so that the key
+ * that settled it is handled without waiting. A pending release is sent early
+ * if another event comes first.
+ *
  * @note Some QMK features handle events before the point where Achordion can
  * intercept them, particularly: Combos, Key Lock, and Dynamic Macros. It's
  * still possible to use these features and Achordion in your keymap, but beware
@@ -22,9 +22,15 @@
 
 #include "autocorrection.h"
 
-#include <string.h>
-
+// AUTOCORRECTION_DATA_FILE may name another generated table, e.g. for tests.
+#ifdef AUTOCORRECTION_DATA_FILE
+#include AUTOCORRECTION_DATA_FILE
+#else
 #include "autocorrection_data.h"
+#endif  // AUTOCORRECTION_DATA_FILE
+#include "key_context.h"
+#include "keycode_class.h"
+#include "output_queue.h"
 
 #pragma message \
     "Autocorrect is now a core QMK feature! To use it, update your QMK set up and see https://docs.qmk.fm/features/autocorrect"
@@ -37,10 +43,219 @@
 #error "Min typo length is less than 4. Autocorrection may behave poorly."
 #endif
 
-bool process_autocorrection(uint16_t keycode, keyrecord_t* record) {
-  static uint8_t typo_buffer[AUTOCORRECTION_MAX_LENGTH] = {0};
-  static uint8_t typo_buffer_size = 0;
+#ifndef AUTOCORRECTION_NUM_STATES
+#error "autocorrection_data.h is out of date. Regenerate it with the \
+current make_autocorrection_data.py."
+#endif
+
+#define SYMBOL_QUOT 26
+#define SYMBOL_SPC 27
+
+// Links are 3 bytes in tables larger than 64KB.
+#ifndef AUTOCORRECTION_LINK_SIZE
+#define AUTOCORRECTION_LINK_SIZE 2
+#endif  // AUTOCORRECTION_LINK_SIZE
+#if AUTOCORRECTION_LINK_SIZE > 2
+typedef uint32_t state_t;
+#else
+typedef uint16_t state_t;
+#endif  // AUTOCORRECTION_LINK_SIZE > 2
+
+// A row with flag 64 is preceded by a failure link or by the last symbol.
+#ifdef AUTOCORRECTION_FAIL_LINKS
+#define FALLBACK_SIZE AUTOCORRECTION_LINK_SIZE
+#else
+#define FALLBACK_SIZE 1
+#endif  // AUTOCORRECTION_FAIL_LINKS
+
+// Bound on the fallbacks followed for one key, as a safeguard against a corrupt
+// table. A valid table follows fewer than the length of its longest typo, which
+// in an uploaded table may exceed AUTOCORRECTION_MAX_LENGTH.
+#ifdef AUTOCORRECTION_LOADABLE
+#define MAX_FALLBACKS 255
+#else
+#define MAX_FALLBACKS AUTOCORRECTION_MAX_LENGTH
+#endif  // AUTOCORRECTION_LOADABLE
+
+#ifdef AUTOCORRECTION_LOADABLE
+#ifdef __AVR__
+#error "autocorrection: AUTOCORRECTION_LOADABLE is not supported on AVR"
+#endif
+#ifndef EECONFIG_USER_DATA_SIZE
+#error "autocorrection: AUTOCORRECTION_LOADABLE needs EECONFIG_USER_DATA_SIZE"
+#endif
+#include "raw_hid.h"
+
+// Room in RAM for an uploaded table, following its header in EEPROM.
+#ifndef AUTOCORRECTION_LOADABLE_SIZE
+#define AUTOCORRECTION_LOADABLE_SIZE (EECONFIG_USER_DATA_SIZE - HEADER_SIZE)
+#endif  // AUTOCORRECTION_LOADABLE_SIZE
+// First byte of raw HID packets for autocorrection.
+#ifndef AUTOCORRECTION_HID_ID
+#define AUTOCORRECTION_HID_ID 0xac
+#endif  // AUTOCORRECTION_HID_ID
+
+// An uploaded table is stored with an 8-byte header:
+//   0-1  magic "AC"
+//   2    FORMAT_VERSION
+//   3    FORMAT_FLAGS of the table, which must match those compiled in
+//   4-5  table size, little endian
+//   6-7  CRC-16/CCITT-FALSE checksum of the table, little endian
+#define HEADER_SIZE 8
+#define FORMAT_VERSION 1
+#ifdef AUTOCORRECTION_BITMAP_ROWS
+#define FLAG_BITMAP_ROWS 1
+#else
+#define FLAG_BITMAP_ROWS 0
+#endif  // AUTOCORRECTION_BITMAP_ROWS
+#ifdef AUTOCORRECTION_FAIL_LINKS
+#define FLAG_FAIL_LINKS 2
+#else
+#define FLAG_FAIL_LINKS 0
+#endif  // AUTOCORRECTION_FAIL_LINKS
+#define FLAG_WIDE_LINKS (AUTOCORRECTION_LINK_SIZE > 2 ? 4 : 0)
+#define FORMAT_FLAGS (FLAG_BITMAP_ROWS | FLAG_FAIL_LINKS | FLAG_WIDE_LINKS)
+
+enum {
+  CMD_INFO = 1,
+  CMD_BEGIN,
+  CMD_DATA,
+  CMD_COMMIT,
+  CMD_RESET,
+};
+
+enum {
+  STATUS_OK = 0,
+  STATUS_BAD_COMMAND,
+  STATUS_BAD_HEADER,
+  STATUS_BAD_RANGE,
+  STATUS_BAD_CHECKSUM,
+  STATUS_BAD_TABLE,
+};
+
+_Static_assert(AUTOCORRECTION_LOADABLE_SIZE <= UINT16_MAX,
+               "autocorrection: AUTOCORRECTION_LOADABLE_SIZE is too large");
+
+// One more byte than the capacity, for a 0 after the table, so that reading a
+// correction string stops there even if the table is corrupt.
+static uint8_t loaded_data[AUTOCORRECTION_LOADABLE_SIZE + 1];
+// Header of the table in loaded_data, or while uploading, of the new table.
+static uint8_t loaded_header[HEADER_SIZE];
+static bool uploading = false;
+
+// The table in use. On ARM, pgm_read_byte() reads RAM as well as flash.
+static const uint8_t* table_data = autocorrection_data;
+static uint16_t table_size = sizeof(autocorrection_data);
+#else
+#define table_data autocorrection_data
+#define table_size sizeof(autocorrection_data)
+#endif  // AUTOCORRECTION_LOADABLE
+
+// Current state of the automaton, as a byte offset into table_data.
+static state_t state = 0;
+// Ring buffer of previous states, to undo transitions on backspace.
+static state_t state_history[AUTOCORRECTION_MAX_LENGTH];
+static uint8_t history_end = 0;
+static uint8_t history_size = 0;
+
+#ifdef AUTOCORRECTION_STATS
+uint32_t autocorrection_rows_visited = 0;
+#endif  // AUTOCORRECTION_STATS
+
+static void reset_state(void) {
+  state = 0;
+  history_size = 0;
+}
+
+static state_t read_link(state_t offset) {
+#if AUTOCORRECTION_LINK_SIZE > 2
+  return (state_t)pgm_read_byte(table_data + offset) |
+         (state_t)pgm_read_byte(table_data + offset + 1) << 8 |
+         (state_t)pgm_read_byte(table_data + offset + 2) << 16;
+#else
+  return (uint16_t)((uint_fast16_t)pgm_read_byte(table_data + offset) |
+                    (uint_fast16_t)pgm_read_byte(table_data + offset + 1)
+                        << 8);
+#endif  // AUTOCORRECTION_LINK_SIZE > 2
+}
+
+// Looks up `symbol` in the row of transitions of the state at `state`, whose
+// first byte is `code`. Returns true and sets `next` if found.
+static bool find_in_row(state_t state, uint8_t code, uint8_t symbol,
+                        state_t* next) {
+  state_t offset = state + 1 + ((code & 64) ? FALLBACK_SIZE : 0);
+  const uint8_t n = code & 31;
+#ifdef AUTOCORRECTION_STATS
+  ++autocorrection_rows_visited;
+#endif  // AUTOCORRECTION_STATS
+#ifdef AUTOCORRECTION_BITMAP_ROWS
+  if (code & 32) {  // Row with a bitmap of its symbols.
+    if (offset + 4 + AUTOCORRECTION_LINK_SIZE * n > table_size) {
+      return false;  // The row runs past the end of the table.
+    }
+    uint32_t bitmap = 0;
+    for (int8_t i = 3; i >= 0; --i) {
+      bitmap = (bitmap << 8) | pgm_read_byte(table_data + offset + i);
+    }
+    if (!((bitmap >> symbol) & 1)) {
+      return false;
+    }
+    // The link index is the number of symbols in the row before `symbol`.
+    const uint8_t index =
+        __builtin_popcountl(bitmap & (((uint32_t)1 << symbol) - 1));
+    if (index >= n) {
+      return false;
+    }
+    *next = read_link(offset + 4 + AUTOCORRECTION_LINK_SIZE * index);
+    return true;
+  }
+#endif  // AUTOCORRECTION_BITMAP_ROWS
+  if (offset + (1 + AUTOCORRECTION_LINK_SIZE) * n > table_size) {
+    return false;  // The row runs past the end of the table.
+  }
+  for (uint8_t i = n; i; --i, offset += 1 + AUTOCORRECTION_LINK_SIZE) {
+    const uint8_t row_symbol = pgm_read_byte(table_data + offset);
+    if (row_symbol == symbol) {
+      *next = read_link(offset + 1);
+      return true;
+    } else if (row_symbol > symbol) {
+      break;
+    }
+  }
+  return false;
+}
+
+// Makes one transition of the automaton. A state lists only the transitions
+// that differ from its defaults. Without AUTOCORRECTION_FAIL_LINKS, the
+// defaults are the transitions from the state for its last symbol alone, or
+// from the root, so a transition takes at most two row lookups and a read from
+// the root row. With it, the defaults are the transitions from the state's
+// failure state, which are followed until a row has the symbol.
+static state_t next_state(state_t from, uint8_t symbol) {
+  for (uint8_t steps = 0; from && from < table_size && steps < MAX_FALLBACKS;
+       ++steps) {
+    state_t next;
+    const uint8_t code = pgm_read_byte(table_data + from);
+    if (find_in_row(from, code, symbol, &next)) {
+      return next;
+    } else if (!(code & 64)) {
+      break;
+    }
+#ifdef AUTOCORRECTION_FAIL_LINKS
+    from = read_link(from + 1);
+#else
+    // The state for the last symbol alone, whose defaults are the root's.
+    const uint8_t last = pgm_read_byte(table_data + from + 1);
+    if (last > SYMBOL_SPC) {
+      break;
+    }
+    from = read_link(AUTOCORRECTION_LINK_SIZE * last);
+#endif  // AUTOCORRECTION_FAIL_LINKS
+  }
+  return read_link(AUTOCORRECTION_LINK_SIZE * symbol);
+}
 
+bool process_autocorrection(uint16_t keycode, keyrecord_t* record) {
   // Ignore key release; we only process key presses.
   if (!record->event.pressed) {
     return true;
@@ -53,16 +268,22 @@ bool process_autocorrection(uint16_t keycode, keyrecord_t* record) {
 #endif  // NO_ACTION_ONESHOT
   // Disable autocorrection while a mod other than shift is active.
   if ((mods & ~MOD_MASK_SHIFT) != 0) {
-    typo_buffer_size = 0;
+    reset_state();
     return true;
   }
 
+#ifdef KEY_CONTEXT_ENABLE
+  // Key Context has unpacked the tap keycode of a tapped tap-hold key, or
+  // KC_NO if held.
+  keycode = get_key_context_keycode();
+#endif  // KEY_CONTEXT_ENABLE
+
   // The following switch cases address various kinds of keycodes. This logic is
   // split over two switches rather than merged into one. The first switch may
   // extract a basic keycode which is then further handled by the second switch,
   // e.g. a layer-tap key with Caps Lock `LT(layer, KC_CAPS)`.
   switch (keycode) {
-#ifndef NO_ACTION_TAPPING
+#if !defined(NO_ACTION_TAPPING) && !defined(KEY_CONTEXT_ENABLE)
     case QK_MOD_TAP ... QK_MOD_TAP_MAX:  // Tap-hold keys.
 #ifndef NO_ACTION_LAYER
     case QK_LAYER_TAP ... QK_LAYER_TAP_MAX:
@@ -73,7 +294,7 @@ bool process_autocorrection(uint16_t keycode, keyrecord_t* record) {
       }
       // Otherwise when tapped, get the basic keycode.
       // Fallthrough intended.
-#endif  // NO_ACTION_TAPPING
+#endif  // !NO_ACTION_TAPPING && !KEY_CONTEXT_ENABLE
 
     // Handle shifted keys, e.g. symbols like KC_EXLM = S(KC_1).
     case QK_LSFT ... QK_LSFT + 255:
@@ -106,102 +327,329 @@ bool process_autocorrection(uint16_t keycode, keyrecord_t* record) {
       return true;  // Ignore these keys.
   }
 
-  if (keycode == KC_QUOT) {
+  uint8_t symbol;
+  if (KC_A <= keycode && keycode <= KC_Z) {
+    symbol = keycode - KC_A;
+  } else if (keycode == KC_QUOT) {
     // Treat " (shifted ') as a word boundary.
-    if ((mods & MOD_MASK_SHIFT) != 0) {
-      keycode = KC_SPC;
-    }
-  } else if (!(KC_A <= keycode && keycode <= KC_Z)) {
-    if (keycode == KC_BSPC) {
-      // Remove last character from the buffer.
-      if (typo_buffer_size > 0) {
-        --typo_buffer_size;
-      }
-      return true;
-    } else if (KC_1 <= keycode && keycode <= KC_SLSH && keycode != KC_ESC) {
-      // Set a word boundary if space, period, digit, etc. is pressed.
-      // Behave more conservatively for the enter key. Reset, so that enter
-      // can't be used on a word ending.
-      if (keycode == KC_ENT) {
-        typo_buffer_size = 0;
-      }
-      keycode = KC_SPC;
+    symbol = ((mods & MOD_MASK_SHIFT) != 0) ? SYMBOL_SPC : SYMBOL_QUOT;
+  } else if (keycode == KC_BSPC) {
+    // Undo the last transition.
+    if (history_size > 0) {
+      --history_size;
+      history_end = (history_end + AUTOCORRECTION_MAX_LENGTH - 1) %
+                    AUTOCORRECTION_MAX_LENGTH;
+      state = state_history[history_end];
     } else {
-      // Clear state if some other non-alpha key is pressed.
-      typo_buffer_size = 0;
-      return true;
+      state = 0;
+    }
+    return true;
+#ifdef KEYCODE_CLASS_ENABLE
+  } else if (get_keycode_class(keycode, 0) & KCC_WORD_BREAK) {
+#else
+  } else if (KC_1 <= keycode && keycode <= KC_SLSH && keycode != KC_ESC) {
+#endif  // KEYCODE_CLASS_ENABLE
+    // Set a word boundary if space, period, digit, etc. is pressed.
+    // Behave more conservatively for the enter key. Reset, so that enter
+    // can't be used on a word ending.
+    if (keycode == KC_ENT) {
+      reset_state();
     }
+    symbol = SYMBOL_SPC;
+  } else {
+    // Clear state if some other non-alpha key is pressed.
+    reset_state();
+    return true;
   }
 
-  // If the buffer is full, rotate it to discard the oldest character.
-  if (typo_buffer_size >= AUTOCORRECTION_MAX_LENGTH) {
-    memmove(typo_buffer, typo_buffer + 1, AUTOCORRECTION_MAX_LENGTH - 1);
-    typo_buffer_size = AUTOCORRECTION_MAX_LENGTH - 1;
+  // Save the current state in the history, discarding the oldest if full.
+  state_history[history_end] = state;
+  history_end = (history_end + 1) % AUTOCORRECTION_MAX_LENGTH;
+  if (history_size < AUTOCORRECTION_MAX_LENGTH) {
+    ++history_size;
   }
 
-  // Append `keycode` to the buffer.
-  // NOTE: `keycode` must be a basic keycode (0-255) by this point.
-  typo_buffer[typo_buffer_size++] = (uint8_t)keycode;
-  // Early return if not many characters have been buffered so far.
-  if (typo_buffer_size < AUTOCORRECTION_MIN_LENGTH) {
+  // Advance the automaton by one transition.
+  state = next_state(state, symbol);
+
+  // Stop if `state` becomes an invalid index. This should not normally
+  // happen, it is a safeguard in case of a bug, data corruption, etc.
+  if (state >= table_size) {
+    reset_state();
     return true;
   }
 
-  // Check whether the buffer ends in a typo. This is done using a trie
-  // stored in `autocorrection_data`.
-  uint16_t state = 0;
-  uint8_t code = pgm_read_byte(autocorrection_data + state);
-  for (int i = typo_buffer_size - 1; i >= 0; --i) {
-    const uint8_t key_i = typo_buffer[i];
+  const uint8_t code = pgm_read_byte(table_data + state);
+  if (state && (code & 128)) {  // A typo was found! Apply autocorrection.
+    const int backspaces = code & 63;
+    for (int i = 0; i < backspaces; ++i) {
+      output_queue_tap_code(KC_BSPC);
+    }
+    // The correction string follows, or with flag 64, a link to where it is
+    // stored as the ending of another entry's string.
+    const state_t correction =
+        (code & 64) ? read_link(state + 1) : state + 1;
+    if (correction >= table_size) {
+      reset_state();
+      return true;
+    }
+    output_queue_send_string_P(
+        (char const*)(table_data + correction));
+
+    reset_state();
+    if (symbol == SYMBOL_SPC) {
+      // Start the next word after the word break.
+      state_history[history_end] = 0;
+      history_end = (history_end + 1) % AUTOCORRECTION_MAX_LENGTH;
+      history_size = 1;
+      state = next_state(0, SYMBOL_SPC);
+      return true;
+    } else {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+#ifdef AUTOCORRECTION_LOADABLE
+static uint16_t crc16(const uint8_t* data, uint16_t size) {
+  uint16_t crc = 0xffff;
+  for (; size; --size) {
+    crc ^= (uint16_t)*data++ << 8;
+    for (uint8_t i = 0; i < 8; ++i) {
+      crc = (crc & 0x8000) ? (crc << 1) ^ 0x1021 : crc << 1;
+    }
+  }
+  return crc;
+}
+
+static uint16_t read_u16(const uint8_t* p) { return p[0] | (p[1] << 8); }
+
+static void write_u16(uint8_t* p, uint16_t value) {
+  p[0] = (uint8_t)value;
+  p[1] = (uint8_t)(value >> 8);
+}
+
+// Checks the header's format. A table must at least hold the root row.
+static bool header_ok(const uint8_t* header) {
+  const uint16_t size = read_u16(header + 4);
+  return header[0] == 'A' && header[1] == 'C' &&
+         header[2] == FORMAT_VERSION && header[3] == FORMAT_FLAGS &&
+         size >= AUTOCORRECTION_LINK_SIZE * (SYMBOL_SPC + 1) &&
+         size <= AUTOCORRECTION_LOADABLE_SIZE;
+}
+
+static bool checksum_ok(void) {
+  return crc16(loaded_data, read_u16(loaded_header + 4)) ==
+         read_u16(loaded_header + 6);
+}
+
+// Checks the structure of the table in use, so that an uploaded table can't
+// send the automaton out of bounds or into a loop. The states must fit end to
+// end in the table, links must point within it, and correction strings must be
+// terminated within it. Fallbacks must point to an earlier state, as states
+// are stored in breadth-first order, so following them always ends.
+static bool table_ok(void) {
+  state_t offset = AUTOCORRECTION_LINK_SIZE * (SYMBOL_SPC + 1);
+  for (state_t i = 0; i < offset; i += AUTOCORRECTION_LINK_SIZE) {
+    if (read_link(i) >= table_size) {
+      return false;
+    }
+  }
 
-    if (code & 64) {  // Check for match in node with multiple children.
-      code &= 63;
-      for (; code != key_i;
-           code = pgm_read_byte(autocorrection_data + (state += 3))) {
-        if (!code) {
-          return true;
+  while (offset < table_size) {
+    const uint8_t code = table_data[offset];
+    state_t end;  // Offset of the next state.
+    if (code & 128) {  // Leaf, with its correction string or a link to it.
+      state_t correction = offset + 1;
+      if (code & 64) {
+        end = offset + 1 + AUTOCORRECTION_LINK_SIZE;
+        if (end > table_size) {
+          return false;
+        }
+        correction = read_link(offset + 1);
+        if (correction >= table_size) {
+          return false;
+        }
+      }
+      const uint8_t* nul =
+          memchr(table_data + correction, 0, table_size - correction);
+      if (nul == NULL) {
+        return false;
+      }
+      if (!(code & 64)) {
+        end = (state_t)(nul - table_data) + 1;
+      }
+    } else {  // Row of transitions.
+      state_t links = offset + 1;
+      if (code & 64) {
+        if (links + FALLBACK_SIZE > table_size) {
+          return false;
+        }
+#ifdef AUTOCORRECTION_FAIL_LINKS
+        const state_t fallback = read_link(links);
+#else
+        const uint8_t last = table_data[links];
+        if (last > SYMBOL_SPC) {
+          return false;
+        }
+        const state_t fallback = read_link(AUTOCORRECTION_LINK_SIZE * last);
+#endif  // AUTOCORRECTION_FAIL_LINKS
+        if (fallback >= offset) {
+          return false;
+        }
+        links += FALLBACK_SIZE;
+      }
+      const uint8_t n = code & 31;
+      uint8_t stride = 1 + AUTOCORRECTION_LINK_SIZE;  // Symbol and link.
+#ifdef AUTOCORRECTION_BITMAP_ROWS
+      if (code & 32) {
+        if (links + 4 > table_size) {
+          return false;
+        }
+        const uint32_t bitmap = (uint32_t)table_data[links] |
+                                (uint32_t)table_data[links + 1] << 8 |
+                                (uint32_t)table_data[links + 2] << 16 |
+                                (uint32_t)table_data[links + 3] << 24;
+        if ((bitmap >> (SYMBOL_SPC + 1)) != 0 ||
+            __builtin_popcountl(bitmap) != n) {
+          return false;
+        }
+        links += 4;
+        stride = AUTOCORRECTION_LINK_SIZE;  // Link only.
+      }
+#endif  // AUTOCORRECTION_BITMAP_ROWS
+      end = links + stride * n;
+      if (end > table_size) {
+        return false;
+      }
+      for (; links < end; links += stride) {
+        const bool has_symbol = stride > AUTOCORRECTION_LINK_SIZE;
+        if ((has_symbol && table_data[links] > SYMBOL_SPC) ||
+            read_link(links + has_symbol) >= table_size) {
+          return false;
         }
       }
+    }
+    offset = end;
+  }
+  return true;
+}
 
-      // Follow link to child node.
-      state = (uint16_t)((uint_fast16_t)pgm_read_byte(autocorrection_data +
-                                                      state + 1) |
-                         (uint_fast16_t)pgm_read_byte(autocorrection_data +
-                                                      state + 2)
-                             << 8);
-      // Otherwise check for match in node with a single child.
-    } else if (code != key_i) {
-      return true;
-    } else if (!(code = pgm_read_byte(autocorrection_data + (++state)))) {
-      ++state;
+// Switches to the table `data`. An uploaded table is checked first, and if it
+// is malformed, the built-in table is used instead. Returns true if `data` is
+// used.
+static bool use_table(const uint8_t* data, uint16_t size) {
+  table_data = data;
+  table_size = size;
+  reset_state();
+  if (data == loaded_data) {
+    loaded_data[size] = 0;
+    if (!table_ok()) {
+      table_data = autocorrection_data;
+      table_size = sizeof(autocorrection_data);
+      return false;
     }
+  }
+  return true;
+}
 
-    // Stop if `state` becomes an invalid index. This should not normally
-    // happen, it is a safeguard in case of a bug, data corruption, etc.
-    if (state >= sizeof(autocorrection_data)) {
-      return true;
+void autocorrection_init(void) {
+  use_table(autocorrection_data, sizeof(autocorrection_data));
+  eeconfig_read_user_datablock(loaded_header, 0, HEADER_SIZE);
+  if (header_ok(loaded_header)) {
+    const uint16_t size = read_u16(loaded_header + 4);
+    eeconfig_read_user_datablock(loaded_data, HEADER_SIZE, size);
+    if (checksum_ok()) {
+      use_table(loaded_data, size);
     }
+  }
+}
+
+// Packets from the host are
+//   AUTOCORRECTION_HID_ID, CMD_INFO
+//   AUTOCORRECTION_HID_ID, CMD_BEGIN, <8-byte header>
+//   AUTOCORRECTION_HID_ID, CMD_DATA, <offset, 2 bytes LE>, <n>, <n bytes>
+//   AUTOCORRECTION_HID_ID, CMD_COMMIT
+//   AUTOCORRECTION_HID_ID, CMD_RESET
+// Each is answered with
+//   AUTOCORRECTION_HID_ID, <command>, <status>, FORMAT_VERSION, FORMAT_FLAGS,
+//   <capacity, 2 bytes LE>, <1 if a loaded table is in use, else 0>,
+//   <table size, 2 bytes LE>, <loaded table checksum, 2 bytes LE>
+// After CMD_BEGIN, the built-in table is used until a successful CMD_COMMIT,
+// which saves the new table to EEPROM and switches to it.
+bool autocorrection_raw_hid_receive(uint8_t* data, uint8_t length) {
+  if (length < 16 || data[0] != AUTOCORRECTION_HID_ID) {
+    return false;
+  }
 
-    // Read first byte of the next node.
-    code = pgm_read_byte(autocorrection_data + state);
+  uint8_t status = STATUS_OK;
+  switch (data[1]) {
+    case CMD_INFO:
+      break;
 
-    if (code & 128) {  // A typo was found! Apply autocorrection.
-      const int backspaces = code & 63;
-      for (int i = 0; i < backspaces; ++i) {
-        tap_code(KC_BSPC);
+    case CMD_BEGIN:
+      if (!header_ok(data + 2)) {
+        status = STATUS_BAD_HEADER;
+        break;
       }
-      send_string_P((char const*)(autocorrection_data + state + 1));
+      use_table(autocorrection_data, sizeof(autocorrection_data));
+      memcpy(loaded_header, data + 2, HEADER_SIZE);
+      uploading = true;
+      break;
 
-      if (keycode == KC_SPC) {
-        typo_buffer[0] = KC_SPC;
-        typo_buffer_size = 1;
-        return true;
+    case CMD_DATA: {
+      const uint16_t offset = read_u16(data + 2);
+      const uint8_t n = data[4];
+      if (!uploading) {
+        status = STATUS_BAD_COMMAND;
+      } else if (n > length - 5 ||
+                 offset + n > read_u16(loaded_header + 4)) {
+        status = STATUS_BAD_RANGE;
       } else {
-        typo_buffer_size = 0;
-        return false;
+        memcpy(loaded_data + offset, data + 5, n);
       }
-    }
+    } break;
+
+    case CMD_COMMIT:
+      if (!uploading) {
+        status = STATUS_BAD_COMMAND;
+      } else if (!checksum_ok()) {
+        status = STATUS_BAD_CHECKSUM;
+        autocorrection_init();  // Restore the table saved in EEPROM, if any.
+      } else if (!use_table(loaded_data, read_u16(loaded_header + 4))) {
+        status = STATUS_BAD_TABLE;
+        autocorrection_init();
+      } else {
+        const uint16_t size = read_u16(loaded_header + 4);
+        eeconfig_update_user_datablock(loaded_header, 0, HEADER_SIZE);
+        eeconfig_update_user_datablock(loaded_data, HEADER_SIZE, size);
+      }
+      uploading = false;
+      break;
+
+    case CMD_RESET: {
+      const uint8_t no_header[HEADER_SIZE] = {0};
+      eeconfig_update_user_datablock(no_header, 0, HEADER_SIZE);
+      use_table(autocorrection_data, sizeof(autocorrection_data));
+      uploading = false;
+    } break;
+
+    default:
+      status = STATUS_BAD_COMMAND;
   }
 
+  const bool loaded = table_data == loaded_data;
+  memset(data + 2, 0, length - 2);
+  data[2] = status;
+  data[3] = FORMAT_VERSION;
+  data[4] = FORMAT_FLAGS;
+  write_u16(data + 5, AUTOCORRECTION_LOADABLE_SIZE);
+  data[7] = loaded;
+  write_u16(data + 8, table_size);
+  write_u16(data + 10, loaded ? read_u16(loaded_header + 6) : 0);
+  raw_hid_send(data, length);
   return true;
 }
+#endif  // AUTOCORRECTION_LOADABLE
@@ -71,14 +71,45 @@
  * script and run
  *
  *     $ python3 make_autocorrection_data.py
- *     Processed 71 autocorrection entries to table with 1120 bytes.
- *
- * The script arranges the entries in autocorrection_dict.txt into a trie and
- * generates autocorrection_data.h with the serialized trie embedded as an
- * array. The .h file will be written in the same directory.
+ *     Processed 71 autocorrection entries to table with 397 states and 2435
+ *     bytes.
+ *
+ * The script compiles the entries in autocorrection_dict.txt into an
+ * Aho-Corasick automaton and generates autocorrection_data.h with the
+ * serialized automaton embedded as an array. The .h file will be written in
+ * the same directory. On each key press, the automaton makes one transition, so
+ * the cost per key doesn't grow with the typo length or dictionary size.
+ *
+ * For large dictionaries, run the script with `--bitmap` to index the larger
+ * states by a bitmap of symbols. This makes the table smaller and each
+ * transition faster. The generated .h file then defines
+ * `AUTOCORRECTION_BITMAP_ROWS`, which selects the matching format in
+ * autocorrection.c. Similarly, the script switches to rows with failure links
+ * (`AUTOCORRECTION_FAIL_LINKS`) where that is smaller, as it is for large
+ * dictionaries, and to 3-byte links (`AUTOCORRECTION_LINK_SIZE`) for tables
+ * over 64KB. The script prints the flash usage and the costliest entries, and
+ * with `--words words.txt` checks for false triggers against a word list.
  *
  * Step 3: Finally, recompile and flash your keymap.
  *
+ * Updating the dictionary without reflashing
+ * ------------------------------------------
+ *
+ * On ARM boards, build with `AUTOCORRECTION_LOADABLE = yes` in rules.mk to
+ * also accept dictionaries over raw HID. An uploaded table is checked against
+ * a versioned header and checksum, and that its states and links lie within
+ * it. It is then saved to the EEPROM user datablock and used in place of
+ * autocorrection_data.h from then on, including after a reboot.
+ * Call autocorrection_init() from keyboard_post_init_user() and
+ * autocorrection_raw_hid_receive() from raw_hid_receive(). The datablock size
+ * `EECONFIG_USER_DATA_SIZE` must hold the table plus 8 bytes, and the EEPROM
+ * must be large enough for it. Then, with the board plugged in, run
+ *
+ *     $ python3 tools/autocorrection_upload.py my_dict.txt
+ *
+ * which compiles the dictionary in the board's table format and uploads it to
+ * every connected board in a second or so. See the script for more options.
+ *
  * For full documentation, see
  * <https://getreuer.info/posts/keyboards/autocorrection>
  *
@@ -109,6 +140,22 @@ extern "C" {
  */
 bool process_autocorrection(uint16_t keycode, keyrecord_t* record);
 
+#ifdef AUTOCORRECTION_LOADABLE
+/** Switches to the dictionary saved in EEPROM, if there is a valid one. */
+void autocorrection_init(void);
+
+/**
+ * Handles a raw HID packet for uploading a dictionary, replying with
+ * raw_hid_send(). Returns false if the packet is not for autocorrection.
+ */
+bool autocorrection_raw_hid_receive(uint8_t* data, uint8_t length);
+#endif  // AUTOCORRECTION_LOADABLE
+
+#ifdef AUTOCORRECTION_STATS
+/** Number of automaton rows looked up, for benchmarking. */
+extern uint32_t autocorrection_rows_visited;
+#endif  // AUTOCORRECTION_STATS
+
 #ifdef __cplusplus
 }
 #endif
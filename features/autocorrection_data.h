@@ -89,80 +89,128 @@
 
 #define AUTOCORRECTION_MIN_LENGTH 5  // ":ture"
 #define AUTOCORRECTION_MAX_LENGTH 10  // "accomodate"
+#define AUTOCORRECTION_NUM_STATES 397
+
+static const uint8_t autocorrection_data[2435] PROGMEM = {56, 0, 66, 0, 70, 0,
+  83, 0, 0, 0, 90, 0, 106, 0, 113, 0, 117, 0, 0, 0, 0, 0, 121, 0, 131, 0, 135,
+  0, 139, 0, 149, 0, 0, 0, 159, 0, 163, 0, 179, 0, 183, 0, 0, 0, 187, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 191, 0, 3, 2, 198, 0, 15, 206, 0, 16, 214, 0, 1, 4, 218, 0,
+  4, 0, 222, 0, 7, 227, 0, 8, 235, 0, 14, 240, 0, 2, 4, 251, 0, 14, 255, 0, 5,
+  0, 4, 1, 8, 12, 1, 11, 17, 1, 14, 22, 1, 17, 27, 1, 2, 0, 32, 1, 20, 37, 1, 1,
+  4, 42, 1, 1, 13, 46, 1, 3, 4, 57, 1, 8, 61, 1, 14, 72, 1, 1, 0, 77, 1, 1, 0,
+  82, 1, 3, 2, 87, 1, 20, 92, 1, 21, 97, 1, 3, 14, 101, 1, 17, 106, 1, 18, 111,
+  1, 1, 4, 116, 1, 5, 0, 135, 1, 4, 140, 1, 8, 144, 1, 19, 149, 1, 22, 157, 1,
+  1, 7, 165, 1, 1, 3, 170, 1, 1, 8, 175, 1, 2, 6, 180, 1, 19, 185, 1, 66, 2, 2,
+  193, 1, 14, 198, 1, 66, 15, 0, 212, 1, 15, 217, 1, 1, 20, 222, 1, 1, 2, 227,
+  1, 65, 0, 20, 232, 1, 66, 7, 4, 237, 1, 14, 241, 1, 65, 8, 4, 246, 1, 67, 14,
+  11, 250, 1, 13, 255, 1, 18, 7, 2, 1, 17, 12, 2, 65, 14, 18, 17, 2, 66, 0, 11,
+  22, 2, 18, 27, 2, 65, 8, 19, 32, 2, 65, 11, 0, 37, 2, 65, 14, 22, 42, 2, 65,
+  17, 4, 47, 2, 65, 0, 20, 69, 2, 65, 20, 0, 74, 2, 1, 8, 79, 2, 67, 13, 2, 87,
+  2, 19, 92, 2, 21, 100, 2, 1, 13, 104, 2, 67, 8, 0, 109, 2, 1, 114, 2, 18, 119,
+  2, 65, 14, 14, 124, 2, 65, 0, 13, 132, 2, 65, 0, 12, 137, 2, 65, 2, 2, 142, 2,
+  65, 20, 15, 150, 2, 1, 4, 158, 2, 65, 14, 18, 162, 2, 65, 17, 8, 167, 2, 65,
+  18, 20, 172, 2, 6, 2, 177, 2, 5, 182, 2, 11, 187, 2, 15, 192, 2, 19, 197, 2,
+  20, 205, 2, 65, 0, 5, 213, 2, 1, 15, 218, 2, 65, 8, 13, 223, 2, 66, 19, 8,
+  237, 2, 17, 242, 2, 66, 22, 8, 247, 2, 19, 255, 2, 65, 7, 17, 4, 3, 65, 3, 15,
+  9, 3, 65, 8, 3, 14, 3, 65, 6, 20, 19, 3, 66, 19, 7, 24, 3, 20, 35, 3, 65, 2,
+  14, 40, 3, 68, 14, 11, 250, 1, 12, 54, 3, 13, 255, 1, 18, 7, 2, 65, 0, 17, 59,
+  3, 65, 15, 0, 67, 3, 65, 20, 8, 72, 3, 65, 2, 20, 77, 3, 65, 20, 7, 82, 3, 1,
+  8, 87, 3, 65, 14, 14, 98, 3, 1, 11, 103, 3, 65, 11, 11, 108, 3, 66, 13, 2,
+  113, 3, 19, 118, 3, 65, 18, 13, 123, 3, 65, 17, 21, 128, 3, 65, 18, 4, 132, 3,
+  65, 11, 4, 139, 3, 65, 18, 11, 146, 3, 65, 19, 11, 151, 3, 65, 0, 18, 156, 3,
+  65, 22, 0, 161, 3, 7, 2, 177, 2, 5, 182, 2, 11, 187, 2, 15, 192, 2, 16, 166,
+  3, 19, 197, 2, 20, 205, 2, 65, 20, 17, 170, 3, 65, 0, 17, 175, 3, 66, 8, 6,
+  180, 3, 17, 185, 3, 65, 2, 11, 190, 3, 66, 19, 4, 195, 3, 15, 199, 3, 1, 11,
+  204, 3, 65, 13, 6, 209, 3, 65, 0, 18, 214, 3, 65, 1, 0, 219, 3, 65, 18, 19,
+  224, 3, 66, 14, 18, 235, 3, 20, 240, 3, 65, 13, 4, 245, 3, 65, 12, 4, 249, 3,
+  66, 2, 0, 253, 3, 20, 5, 4, 66, 15, 19, 10, 4, 20, 15, 4, 1, 17, 20, 4, 65,
+  18, 19, 25, 4, 65, 8, 21, 33, 4, 65, 20, 4, 37, 4, 65, 2, 8, 41, 4, 65, 5, 4,
+  46, 4, 65, 11, 4, 50, 4, 65, 15, 8, 57, 4, 66, 19, 17, 62, 4, 20, 67, 4, 66,
+  20, 18, 72, 4, 19, 77, 4, 65, 5, 19, 82, 4, 65, 15, 4, 87, 4, 68, 13, 2, 87,
+  2, 6, 91, 4, 19, 92, 2, 21, 100, 2, 65, 8, 17, 96, 4, 65, 17, 8, 101, 4, 66,
+  8, 3, 14, 3, 19, 106, 4, 65, 19, 8, 111, 4, 65, 17, 4, 116, 4, 65, 15, 0, 138,
+  4, 65, 3, 7, 143, 4, 65, 20, 0, 148, 4, 67, 7, 4, 156, 4, 8, 163, 4, 17, 4, 3,
+  65, 20, 17, 168, 4, 68, 14, 11, 250, 1, 12, 173, 4, 13, 255, 1, 18, 7, 2, 65,
+  12, 12, 178, 4, 66, 17, 4, 183, 4, 17, 205, 4, 65, 0, 17, 210, 4, 65, 8, 17,
+  218, 4, 65, 20, 0, 223, 4, 65, 7, 6, 228, 4, 67, 8, 5, 233, 4, 6, 180, 3, 17,
+  185, 3, 65, 14, 18, 238, 4, 65, 11, 8, 243, 4, 65, 11, 4, 1, 5, 65, 2, 4, 8,
+  5, 65, 19, 8, 12, 5, 65, 13, 19, 17, 5, 1, 8, 22, 5, 2, 13, 27, 5, 15, 218, 2,
+  2, 13, 104, 2, 18, 32, 5, 65, 11, 4, 36, 5, 65, 11, 4, 39, 5, 65, 18, 4, 46,
+  5, 65, 0, 17, 52, 5, 1, 20, 57, 5, 65, 17, 0, 62, 5, 65, 17, 0, 67, 5, 65, 6,
+  19, 72, 5, 65, 17, 0, 77, 5, 65, 11, 20, 82, 5, 1, 17, 87, 5, 65, 15, 20, 92,
+  5, 65, 11, 8, 97, 5, 65, 6, 7, 108, 5, 65, 18, 8, 113, 5, 65, 0, 17, 121, 5,
+  67, 19, 8, 237, 2, 13, 126, 5, 17, 242, 2, 65, 18, 4, 131, 5, 65, 20, 15, 138,
+  5, 1, 5, 143, 5, 1, 18, 148, 5, 66, 0, 18, 156, 5, 20, 232, 1, 65, 20, 17,
+  161, 5, 65, 19, 20, 166, 5, 65, 20, 19, 171, 5, 65, 17, 8, 177, 5, 66, 19, 8,
+  182, 5, 17, 242, 2, 1, 8, 190, 5, 1, 3, 195, 5, 65, 8, 4, 200, 5, 1, 17, 207,
+  5, 2, 13, 104, 2, 21, 212, 5, 65, 8, 19, 216, 5, 65, 17, 20, 221, 5, 65, 20,
+  13, 226, 5, 65, 18, 11, 230, 5, 65, 19, 17, 235, 5, 65, 19, 4, 240, 5, 1, 17,
+  244, 5, 65, 6, 4, 249, 5, 65, 17, 13, 253, 5, 65, 8, 6, 2, 6, 65, 19, 7, 7, 6,
+  65, 8, 2, 15, 6, 7, 2, 177, 2, 5, 182, 2, 11, 187, 2, 15, 192, 2, 18, 20, 6,
+  19, 197, 2, 20, 205, 2, 65, 0, 19, 25, 6, 65, 7, 19, 30, 6, 66, 0, 6, 34, 6,
+  17, 175, 3, 2, 8, 79, 2, 27, 39, 6, 65, 8, 4, 44, 6, 65, 17, 4, 48, 6, 65, 12,
+  14, 53, 6, 65, 12, 14, 58, 6, 7, 2, 177, 2, 5, 182, 2, 11, 187, 2, 13, 63, 6,
+  15, 192, 2, 19, 197, 2, 20, 205, 2, 65, 17, 4, 68, 6, 66, 17, 0, 90, 6, 17,
+  95, 6, 65, 17, 4, 100, 6, 65, 0, 18, 108, 6, 65, 6, 19, 113, 6, 130, 105, 101,
+  102, 0, 65, 18, 4, 118, 6, 68, 8, 0, 109, 2, 1, 114, 2, 13, 125, 6, 18, 119,
+  2, 2, 6, 139, 6, 13, 104, 2, 1, 13, 144, 6, 65, 8, 0, 149, 6, 130, 110, 115,
+  116, 0, 65, 8, 4, 154, 6, 65, 13, 26, 158, 6, 129, 115, 101, 0, 194, 48, 5, 2,
+  13, 104, 2, 17, 162, 6, 131, 97, 108, 115, 101, 0, 65, 17, 3, 168, 6, 65, 20,
+  4, 175, 6, 65, 0, 13, 179, 6, 65, 0, 19, 184, 6, 65, 19, 7, 189, 6, 65, 0, 17,
+  193, 6, 65, 20, 4, 198, 6, 65, 17, 0, 202, 6, 65, 20, 19, 207, 6, 67, 8, 0,
+  210, 6, 1, 114, 2, 18, 119, 2, 65, 7, 19, 218, 6, 66, 8, 13, 223, 2, 14, 222,
+  6, 65, 17, 24, 227, 6, 65, 13, 4, 233, 6, 2, 15, 218, 2, 18, 237, 6, 129, 107,
+  117, 112, 0, 65, 5, 8, 242, 6, 66, 18, 0, 250, 6, 15, 2, 7, 65, 18, 18, 7, 7,
+  65, 17, 4, 12, 7, 65, 20, 19, 34, 7, 130, 116, 112, 117, 116, 0, 65, 8, 3, 37,
+  7, 66, 8, 14, 42, 7, 17, 96, 4, 65, 8, 11, 47, 7, 65, 3, 14, 52, 7, 2, 11,
+  103, 3, 21, 58, 7, 65, 17, 4, 62, 7, 1, 4, 84, 7, 65, 19, 8, 88, 7, 65, 20,
+  13, 93, 7, 128, 114, 110, 0, 65, 11, 19, 96, 7, 65, 17, 13, 102, 7, 1, 24,
+  108, 7, 65, 17, 0, 113, 7, 1, 3, 118, 7, 65, 13, 6, 124, 7, 65, 6, 13, 130, 7,
+  66, 7, 2, 134, 7, 17, 4, 3, 65, 2, 7, 138, 7, 65, 18, 14, 144, 7, 65, 19, 4,
+  149, 7, 129, 116, 104, 0, 65, 6, 4, 156, 7, 65, 27, 19, 162, 7, 1, 17, 170, 7,
+  130, 114, 117, 101, 0, 65, 14, 3, 175, 7, 65, 14, 3, 180, 7, 65, 13, 19, 185,
+  7, 7, 2, 177, 2, 5, 182, 2, 11, 187, 2, 13, 193, 7, 15, 192, 2, 19, 197, 2,
+  20, 205, 2, 65, 0, 13, 198, 7, 65, 17, 4, 203, 7, 132, 99, 113, 117, 105, 114,
+  101, 0, 65, 18, 4, 225, 7, 130, 103, 104, 116, 0, 2, 13, 231, 7, 15, 218, 2,
+  68, 13, 2, 87, 2, 6, 236, 7, 19, 92, 2, 21, 100, 2, 65, 6, 20, 244, 7, 65, 13,
+  18, 252, 7, 65, 0, 13, 1, 8, 1, 3, 6, 8, 1, 19, 12, 8, 131, 108, 116, 101,
+  114, 0, 131, 114, 119, 97, 114, 100, 0, 1, 2, 19, 8, 65, 13, 19, 24, 8, 65,
+  19, 4, 29, 8, 129, 104, 116, 0, 65, 17, 2, 33, 8, 1, 3, 38, 8, 65, 0, 19, 42,
+  8, 195, 173, 5, 66, 0, 3, 47, 8, 18, 214, 3, 129, 116, 104, 0, 65, 14, 13, 53,
+  8, 130, 114, 97, 114, 121, 0, 1, 17, 59, 8, 65, 18, 27, 65, 8, 66, 8, 18, 70,
+  8, 19, 32, 2, 66, 0, 5, 213, 2, 15, 75, 8, 65, 15, 2, 86, 8, 65, 18, 8, 91, 8,
+  7, 2, 177, 2, 3, 99, 8, 5, 182, 2, 11, 187, 2, 15, 192, 2, 19, 197, 2, 20,
+  205, 2, 195, 172, 5, 65, 3, 4, 104, 8, 65, 14, 13, 110, 8, 65, 11, 4, 113, 8,
+  131, 101, 117, 100, 111, 0, 1, 4, 120, 8, 7, 2, 177, 2, 3, 126, 8, 5, 182, 2,
+  11, 187, 2, 15, 192, 2, 19, 197, 2, 20, 205, 2, 1, 13, 129, 8, 65, 8, 19, 134,
+  8, 194, 104, 7, 131, 115, 117, 108, 116, 0, 131, 116, 117, 114, 110, 0, 130,
+  101, 116, 121, 0, 65, 0, 19, 139, 8, 131, 103, 110, 101, 100, 0, 131, 114,
+  105, 110, 103, 0, 129, 110, 103, 0, 129, 99, 104, 0, 131, 105, 116, 99, 104,
+  0, 65, 14, 11, 144, 8, 132, 112, 100, 97, 116, 101, 0, 131, 97, 117, 103, 101,
+  0, 66, 19, 7, 149, 8, 20, 35, 3, 130, 101, 105, 114, 0, 65, 3, 0, 160, 8, 65,
+  3, 0, 165, 8, 132, 112, 97, 114, 101, 110, 116, 0, 65, 13, 19, 170, 8, 65, 13,
+  19, 173, 8, 7, 2, 177, 2, 5, 182, 2, 11, 187, 2, 13, 176, 8, 15, 192, 2, 19,
+  197, 2, 20, 205, 2, 131, 97, 117, 115, 101, 0, 131, 115, 101, 110, 0, 133,
+  101, 105, 108, 105, 110, 103, 0, 66, 20, 0, 74, 2, 4, 181, 8, 65, 18, 20, 187,
+  8, 65, 13, 18, 192, 8, 131, 105, 118, 101, 100, 0, 132, 101, 115, 110, 39,
+  116, 0, 65, 2, 24, 198, 8, 65, 19, 4, 203, 8, 1, 4, 207, 8, 65, 2, 7, 210, 8,
+  129, 100, 101, 0, 65, 19, 14, 221, 8, 131, 97, 108, 105, 100, 0, 131, 105,
+  115, 111, 110, 0, 130, 101, 110, 101, 114, 0, 132, 115, 101, 115, 0, 65, 18,
+  19, 226, 8, 67, 15, 0, 212, 1, 2, 233, 8, 15, 217, 1, 65, 2, 0, 238, 8, 66, 8,
+  13, 223, 2, 14, 246, 8, 129, 114, 101, 100, 0, 130, 114, 105, 100, 101, 0,
+  195, 125, 9, 2, 3, 251, 8, 13, 104, 2, 131, 101, 105, 118, 101, 0, 193, 100,
+  8, 65, 13, 19, 0, 9, 65, 19, 8, 5, 9, 65, 19, 4, 10, 9, 65, 11, 3, 17, 9, 67,
+  7, 4, 23, 9, 8, 163, 4, 17, 4, 3, 65, 0, 19, 30, 9, 65, 0, 19, 35, 9, 197,
+  186, 7, 194, 189, 7, 65, 13, 19, 40, 9, 130, 97, 103, 117, 101, 0, 65, 20, 18,
+  43, 9, 131, 97, 105, 110, 115, 0, 129, 110, 99, 121, 0, 1, 4, 51, 9, 194, 56,
+  9, 67, 7, 4, 237, 1, 14, 241, 1, 24, 61, 9, 65, 14, 17, 71, 9, 132, 105, 102,
+  101, 115, 116, 0, 65, 2, 4, 80, 9, 66, 0, 4, 86, 9, 20, 232, 1, 65, 14, 13,
+  89, 9, 65, 3, 6, 92, 9, 130, 97, 110, 116, 0, 65, 8, 14, 97, 9, 132, 97, 114,
+  97, 116, 101, 0, 130, 104, 111, 108, 100, 0, 2, 8, 79, 2, 27, 102, 9, 65, 19,
+  4, 104, 9, 65, 19, 4, 107, 9, 195, 189, 7, 133, 115, 101, 110, 115, 117, 115,
+  0, 135, 117, 97, 114, 97, 110, 116, 101, 101, 0, 135, 105, 101, 114, 97, 114,
+  99, 104, 121, 0, 135, 116, 101, 114, 97, 116, 111, 114, 0, 131, 112, 97, 99,
+  101, 0, 194, 82, 9, 195, 127, 9, 65, 6, 4, 118, 9, 65, 14, 13, 122, 9, 132, 0,
+  196, 111, 9, 135, 99, 111, 109, 109, 111, 100, 97, 116, 101, 0, 130, 103, 101,
+  0, 134, 101, 116, 105, 116, 105, 111, 110, 0};
 
-static const uint8_t autocorrection_data[1120] PROGMEM = {
-    108, 43,  0,   6,   71,  0,   7,   81,  0,   8,   199, 0,   9,   240, 1,
-    10,  250, 1,   11,  26,  2,   17,  53,  2,   18,  190, 2,   19,  202, 2,
-    21,  212, 2,   22,  20,  3,   23,  67,  3,   28,  32,  4,   0,   72,  50,
-    0,   22,  60,  0,   0,   11,  23,  44,  8,   11,  23,  44,  0,   132, 0,
-    8,   22,  18,  18,  15,  0,   132, 115, 101, 115, 0,   11,  23,  12,  26,
-    22,  0,   129, 99,  104, 0,   68,  94,  0,   8,   106, 0,   15,  174, 0,
-    21,  187, 0,   0,   12,  15,  25,  17,  12,  0,   131, 97,  108, 105, 100,
-    0,   74,  119, 0,   12,  129, 0,   21,  140, 0,   24,  165, 0,   0,   17,
-    12,  22,  0,   131, 103, 110, 101, 100, 0,   25,  21,  8,   7,   0,   131,
-    105, 118, 101, 100, 0,   72,  147, 0,   24,  156, 0,   0,   9,   8,   21,
-    0,   129, 114, 101, 100, 0,   6,   6,   18,  0,   129, 114, 101, 100, 0,
-    15,  6,   17,  12,  0,   129, 100, 101, 0,   18,  22,  8,   21,  11,  23,
-    0,   130, 104, 111, 108, 100, 0,   4,   26,  18,  9,   0,   131, 114, 119,
-    97,  114, 100, 0,   68,  233, 0,   6,   246, 0,   7,   4,   1,   8,   16,
-    1,   10,  52,  1,   15,  81,  1,   21,  90,  1,   22,  117, 1,   23,  144,
-    1,   24,  215, 1,   25,  228, 1,   0,   6,   19,  22,  8,   16,  4,   17,
-    0,   130, 97,  99,  101, 0,   19,  4,   22,  8,   16,  4,   17,  0,   131,
-    112, 97,  99,  101, 0,   12,  21,  8,   25,  18,  0,   130, 114, 105, 100,
-    101, 0,   23,  0,   68,  25,  1,   17,  36,  1,   0,   21,  4,   24,  10,
-    0,   130, 110, 116, 101, 101, 0,   4,   21,  24,  4,   10,  0,   135, 117,
-    97,  114, 97,  110, 116, 101, 101, 0,   68,  59,  1,   7,   69,  1,   0,
-    24,  10,  44,  0,   131, 97,  117, 103, 101, 0,   8,   15,  12,  25,  12,
-    21,  19,  0,   130, 103, 101, 0,   22,  4,   9,   0,   130, 108, 115, 101,
-    0,   76,  97,  1,   24,  109, 1,   0,   24,  20,  4,   0,   132, 99,  113,
-    117, 105, 114, 101, 0,   23,  44,  0,   130, 114, 117, 101, 0,   4,   0,
-    79,  126, 1,   24,  134, 1,   0,   9,   0,   131, 97,  108, 115, 101, 0,
-    6,   8,   5,   0,   131, 97,  117, 115, 101, 0,   4,   0,   71,  156, 1,
-    19,  193, 1,   21,  203, 1,   0,   18,  16,  0,   80,  166, 1,   18,  181,
-    1,   0,   18,  6,   4,   0,   135, 99,  111, 109, 109, 111, 100, 97,  116,
-    101, 0,   6,   6,   4,   0,   132, 109, 111, 100, 97,  116, 101, 0,   7,
-    24,  0,   132, 112, 100, 97,  116, 101, 0,   8,   19,  8,   22,  0,   132,
-    97,  114, 97,  116, 101, 0,   10,  8,   15,  15,  18,  6,   0,   130, 97,
-    103, 117, 101, 0,   8,   12,  6,   8,   21,  0,   131, 101, 105, 118, 101,
-    0,   12,  8,   11,  6,   0,   130, 105, 101, 102, 0,   17,  0,   76,  3,
-    2,   21,  16,  2,   0,   15,  8,   12,  6,   0,   133, 101, 105, 108, 105,
-    110, 103, 0,   12,  23,  22,  0,   131, 114, 105, 110, 103, 0,   70,  33,
-    2,   23,  44,  2,   0,   12,  23,  26,  22,  0,   131, 105, 116, 99,  104,
-    0,   10,  12,  8,   11,  0,   129, 104, 116, 0,   72,  69,  2,   10,  80,
-    2,   18,  89,  2,   21,  156, 2,   24,  167, 2,   0,   22,  18,  18,  11,
-    6,   0,   131, 115, 101, 110, 0,   12,  21,  23,  22,  0,   129, 110, 103,
-    0,   12,  0,   86,  98,  2,   23,  124, 2,   0,   68,  105, 2,   22,  114,
-    2,   0,   12,  15,  0,   131, 105, 115, 111, 110, 0,   4,   6,   6,   18,
-    0,   131, 105, 111, 110, 0,   76,  131, 2,   22,  146, 2,   0,   23,  12,
-    19,  8,   21,  0,   134, 101, 116, 105, 116, 105, 111, 110, 0,   18,  19,
-    0,   131, 105, 116, 105, 111, 110, 0,   23,  24,  8,   21,  0,   131, 116,
-    117, 114, 110, 0,   85,  174, 2,   23,  183, 2,   0,   23,  8,   21,  0,
-    130, 117, 114, 110, 0,   8,   21,  0,   128, 114, 110, 0,   7,   8,   24,
-    22,  19,  0,   131, 101, 117, 100, 111, 0,   24,  18,  18,  15,  0,   129,
-    107, 117, 112, 0,   72,  219, 2,   18,  3,   3,   0,   76,  229, 2,   15,
-    238, 2,   17,  248, 2,   0,   11,  23,  44,  0,   130, 101, 105, 114, 0,
-    23,  12,  9,   0,   131, 108, 116, 101, 114, 0,   23,  22,  12,  15,  0,
-    130, 101, 110, 101, 114, 0,   23,  4,   21,  8,   23,  17,  12,  0,   135,
-    116, 101, 114, 97,  116, 111, 114, 0,   72,  30,  3,   17,  38,  3,   24,
-    51,  3,   0,   15,  4,   9,   0,   129, 115, 101, 0,   4,   12,  23,  17,
-    18,  6,   0,   131, 97,  105, 110, 115, 0,   22,  17,  8,   6,   17,  18,
-    6,   0,   133, 115, 101, 110, 115, 117, 115, 0,   116, 89,  3,   10,  102,
-    3,   11,  112, 3,   15,  134, 3,   17,  145, 3,   22,  234, 3,   24,  248,
-    3,   0,   17,  8,   22,  18,  7,   0,   132, 101, 115, 110, 39,  116, 0,
-    11,  24,  4,   6,   0,   130, 103, 104, 116, 0,   71,  119, 3,   10,  126,
-    3,   0,   12,  26,  0,   129, 116, 104, 0,   17,  8,   15,  0,   129, 116,
-    104, 0,   22,  24,  8,   21,  0,   131, 115, 117, 108, 116, 0,   68,  155,
-    3,   8,   166, 3,   22,  226, 3,   0,   21,  4,   19,  19,  4,   0,   130,
-    101, 110, 116, 0,   85,  173, 3,   25,  216, 3,   0,   68,  180, 3,   21,
-    191, 3,   0,   19,  4,   0,   132, 112, 97,  114, 101, 110, 116, 0,   4,
-    19,  0,   68,  201, 3,   19,  209, 3,   0,   133, 112, 97,  114, 101, 110,
-    116, 0,   4,   0,   131, 101, 110, 116, 0,   8,   15,  8,   21,  0,   130,
-    97,  110, 116, 0,   18,  6,   0,   130, 110, 115, 116, 0,   12,  9,   8,
-    17,  4,   16,  0,   132, 105, 102, 101, 115, 116, 0,   83,  255, 3,   23,
-    22,  4,   0,   87,  6,   4,   24,  14,  4,   0,   17,  12,  0,   131, 112,
-    117, 116, 0,   18,  0,   130, 116, 112, 117, 116, 0,   19,  24,  18,  0,
-    131, 116, 112, 117, 116, 0,   70,  45,  4,   8,   57,  4,   11,  67,  4,
-    21,  85,  4,   0,   8,   24,  20,  8,   21,  9,   0,   129, 110, 99,  121,
-    0,   23,  9,   4,   22,  0,   130, 101, 116, 121, 0,   6,   21,  4,   21,
-    12,  8,   11,  0,   135, 105, 101, 114, 97,  114, 99,  104, 121, 0,   4,
-    5,   12,  15,  0,   130, 114, 97,  114, 121, 0};
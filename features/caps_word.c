@@ -22,6 +22,8 @@
 
 #include "caps_word.h"
 
+#include "deadlines.h"
+
 #pragma message \
     "Caps Word is now a core QMK feature! To use it, update your QMK set up and see https://docs.qmk.fm/features/caps_word"
 
@@ -130,6 +132,7 @@ bool process_caps_word(uint16_t keycode, keyrecord_t* record) {
   } else {
 #if CAPS_WORD_IDLE_TIMEOUT > 0
     idle_timer = record->event.time + CAPS_WORD_IDLE_TIMEOUT;
+    deadline_set(caps_word_task, idle_timer);
 #endif  // CAPS_WORD_IDLE_TIMEOUT > 0
   }
 
@@ -234,6 +237,7 @@ void caps_word_on(void) {
 #endif  // NO_ACTION_ONESHOT
 #if CAPS_WORD_IDLE_TIMEOUT > 0
   idle_timer = timer_read() + CAPS_WORD_IDLE_TIMEOUT;
+  deadline_set(caps_word_task, idle_timer);
 #endif  // CAPS_WORD_IDLE_TIMEOUT > 0
 
   caps_word_active = true;
@@ -247,6 +251,9 @@ void caps_word_off(void) {
 
   unregister_weak_mods(MOD_BIT(KC_LSFT));  // Make sure weak shift is off.
   caps_word_active = false;
+#if CAPS_WORD_IDLE_TIMEOUT > 0
+  deadline_cancel(caps_word_task);
+#endif  // CAPS_WORD_IDLE_TIMEOUT > 0
   caps_word_set_user(false);
 }
 
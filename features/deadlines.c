@@ -0,0 +1,125 @@
+// Copyright 2026 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file deadlines.c
+ * @brief Deadlines implementation
+ */
+
+#include "deadlines.h"
+
+#ifdef DEADLINES_ENABLE
+
+#ifndef DEADLINES_SIZE
+#define DEADLINES_SIZE 8
+#endif  // DEADLINES_SIZE
+
+#if DEADLINES_SIZE < 1 || DEADLINES_SIZE > 32
+#error "deadlines: DEADLINES_SIZE must be between 1 and 32"
+#endif
+
+// Entries sorted by time, soonest first. Since all deadlines are within
+// DEADLINE_MAX_DELAY of now, times compare correctly across timer wraparound.
+static struct {
+  uint16_t time;
+  deadline_callback_t callback;
+} entries[DEADLINES_SIZE];
+static uint8_t num_entries = 0;
+// Set once the list has overflowed, after which tasks are also polled.
+static bool polling = false;
+
+static void remove_entry(uint8_t i) {
+  --num_entries;
+  memmove(&entries[i], &entries[i + 1], (num_entries - i) * sizeof(entries[0]));
+}
+
+void deadline_cancel(deadline_callback_t callback) {
+  for (uint8_t i = 0; i < num_entries; ++i) {
+    if (entries[i].callback == callback) {
+      remove_entry(i);
+      return;
+    }
+  }
+}
+
+void deadline_set(deadline_callback_t callback, uint16_t time) {
+  deadline_cancel(callback);
+  uint8_t n = num_entries;
+  if (n >= DEADLINES_SIZE) {
+    // The latest deadline doesn't fit. Its task still runs, since from now on
+    // the keymap polls all tasks, as it would without Deadlines.
+    if (!polling) {
+      dprintln("Deadlines: Full. Falling back to polling.");
+      polling = true;
+    }
+    n = DEADLINES_SIZE - 1;
+    if (timer_expired(time, entries[n].time)) {
+      return;
+    }
+  }
+
+  // Insert after entries with the same or an earlier time.
+  uint8_t i = n;
+  while (i > 0 && !timer_expired(time, entries[i - 1].time)) {
+    entries[i] = entries[i - 1];
+    --i;
+  }
+  entries[i].time = time;
+  entries[i].callback = callback;
+  num_entries = n + 1;
+}
+
+void deadline_set_in(deadline_callback_t callback, uint32_t delay_ms) {
+  if (delay_ms > DEADLINE_MAX_DELAY) {
+    delay_ms = DEADLINE_MAX_DELAY;
+  }
+  deadline_set(callback, timer_read() + (uint16_t)delay_ms);
+}
+
+void deadline_task(void) {
+  const uint16_t now = timer_read();
+  if (!num_entries || !timer_expired(now, entries[0].time)) {
+    return;  // Nothing is due.
+  }
+
+  // Take the due entries off the list before calling them, since callbacks may
+  // set new deadlines. A callback that sets one for now runs on the next call.
+  deadline_callback_t due[DEADLINES_SIZE];
+  uint8_t num_due = 0;
+  do {
+    due[num_due++] = entries[0].callback;
+    remove_entry(0);
+  } while (num_entries && timer_expired(now, entries[0].time));
+
+  for (uint8_t i = 0; i < num_due; ++i) {
+    due[i]();
+  }
+}
+
+bool deadline_polling(void) { return polling; }
+
+uint16_t deadline_idle_ms(void) {
+  if (polling) {
+    return 0;  // Polled tasks may have timeouts that aren't in the list.
+  }
+  if (!num_entries) {
+    return DEADLINE_NONE;
+  }
+  const uint16_t now = timer_read();
+  return timer_expired(now, entries[0].time)
+             ? 0
+             : TIMER_DIFF_16(entries[0].time, now);
+}
+
+#endif  // DEADLINES_ENABLE
@@ -0,0 +1,128 @@
+// Copyright 2026 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file deadlines.h
+ * @brief Deadlines - run housekeeping tasks only when they are due
+ *
+ * Overview
+ * --------
+ *
+ * Features with timeouts, like Caps Word, Sentence Case, Select Word, Layer
+ * Lock, Achordion, and Orbital Mouse, each have a task function to call from
+ * housekeeping. Polled every loop, each task reads the timer only to find that
+ * it has nothing to do, which is nearly always the case.
+ *
+ * Deadlines is a short list of (time, callback) entries, sorted by time. A
+ * feature sets a deadline for its task when it starts or extends a timeout,
+ * and deadline_task() calls the tasks whose deadlines have passed. While none
+ * are due, deadline_task() costs one timer read and one comparison, however
+ * many features use it. Since the list knows the next time that anything will
+ * happen, deadline_idle_ms() gives how long the keyboard may sleep.
+ *
+ * Each callback has at most one deadline; setting it again moves it. A task
+ * that is called early or spuriously, e.g. after its timeout was cancelled,
+ * must check its own state and do nothing, as tasks polled every loop already
+ * do. So it remains fine to also call such tasks directly.
+ *
+ *
+ * Add it to your keymap
+ * ---------------------
+ *
+ * In rules.mk, set `DEADLINES_ENABLE = yes`. The features above then set
+ * deadlines for their tasks, so that in keymap.c, call deadline_task() and
+ * call the tasks themselves only while `deadline_polling()`:
+ *
+ *     #include "features/deadlines.h"
+ *
+ *     void housekeeping_task_user(void) {
+ *       deadline_task();
+ *       if (deadline_polling()) {
+ *         caps_word_task();
+ *         // Other tasks...
+ *       }
+ *     }
+ *
+ * In your own code, call `deadline_set(my_task, time)` with a 16-bit timer
+ * time, or `deadline_set_in(my_task, delay_ms)`. Deadlines are at most
+ * `DEADLINE_MAX_DELAY` (30000) ms away; longer delays are clamped, so that the
+ * task runs early and should set the deadline again for the remaining time.
+ *
+ * The list holds `DEADLINES_SIZE` entries (default 8), one per task. If more
+ * tasks than that set deadlines at once, the latest deadline is dropped, and
+ * Deadlines falls back to polling: from then on, deadline_polling() is true, so
+ * that every task is called each loop and none misses its timeout. A message
+ * is printed when debugging; increase `DEADLINES_SIZE` if it appears. Without
+ * Deadlines, deadline_polling() is always true.
+ *
+ * To wait in low power between events, sleep for at most deadline_idle_ms(),
+ * which is `DEADLINE_NONE` when no deadline is set, and 0 while polling.
+ */
+
+#pragma once
+
+#include "quantum.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Longest delay from now of a deadline, in ms. */
+#define DEADLINE_MAX_DELAY 30000
+/** Returned by deadline_idle_ms() when no deadline is set. */
+#define DEADLINE_NONE UINT16_MAX
+
+typedef void (*deadline_callback_t)(void);
+
+#ifdef DEADLINES_ENABLE
+
+/**
+ * Sets the deadline for `callback` to the 16-bit timer time `time`, replacing
+ * the callback's previous deadline, if any.
+ */
+void deadline_set(deadline_callback_t callback, uint16_t time);
+
+/** Sets the deadline for `callback` to `delay_ms` from now. */
+void deadline_set_in(deadline_callback_t callback, uint32_t delay_ms);
+
+/** Cancels the deadline for `callback`, if any. */
+void deadline_cancel(deadline_callback_t callback);
+
+/** Calls callbacks whose deadlines have passed. Call from housekeeping. */
+void deadline_task(void);
+
+/**
+ * Whether the keymap should call tasks every loop, as it would without
+ * Deadlines. Becomes true if the list ever overflows.
+ */
+bool deadline_polling(void);
+
+/** Ms until the next deadline, 0 if one is due, or `DEADLINE_NONE`. */
+uint16_t deadline_idle_ms(void);
+
+#else
+
+static inline void deadline_set(deadline_callback_t callback, uint16_t time) {}
+static inline void deadline_set_in(deadline_callback_t callback,
+                                   uint32_t delay_ms) {}
+static inline void deadline_cancel(deadline_callback_t callback) {}
+static inline void deadline_task(void) {}
+static inline bool deadline_polling(void) { return true; }
+static inline uint16_t deadline_idle_ms(void) { return 0; }
+
+#endif  // DEADLINES_ENABLE
+
+#ifdef __cplusplus
+}
+#endif
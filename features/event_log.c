@@ -0,0 +1,111 @@
+// Copyright 2026 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file event_log.c
+ * @brief Event Log implementation
+ */
+
+#include "event_log.h"
+
+#ifdef EVENT_LOG_ENABLE
+
+#ifndef EVENT_LOG_SIZE
+#define EVENT_LOG_SIZE 16
+#endif  // EVENT_LOG_SIZE
+
+#ifndef EVENT_LOG_FLUSH_COUNT
+#define EVENT_LOG_FLUSH_COUNT 1
+#endif  // EVENT_LOG_FLUSH_COUNT
+
+#if EVENT_LOG_SIZE < 2 || EVENT_LOG_SIZE > 128 || \
+    (EVENT_LOG_SIZE & (EVENT_LOG_SIZE - 1))
+#error "event_log: EVENT_LOG_SIZE must be a power of 2 between 2 and 128"
+#endif
+
+static event_log_record_t ring[EVENT_LOG_SIZE];
+// Records are written at `head` and read at `tail`. The indices run freely
+// and are masked on access, so that the ring is full when they differ by
+// EVENT_LOG_SIZE.
+static uint8_t head = 0;
+static uint8_t tail = 0;
+static uint16_t num_dropped = 0;
+
+void event_log_record(uint16_t keycode, keyrecord_t* record) {
+  if (!debug_enable) {
+    return;
+  }
+  if ((uint8_t)(head - tail) >= EVENT_LOG_SIZE) {
+    if (num_dropped < UINT16_MAX) {
+      ++num_dropped;
+    }
+    return;
+  }
+
+  event_log_record_t* r = &ring[head++ & (EVENT_LOG_SIZE - 1)];
+  r->time = record->event.time;
+  r->keycode = keycode;
+  r->row = record->event.key.row;
+  r->col = record->event.key.col;
+  r->layer = read_source_layers_cache(record->event.key);
+  r->flags = record->event.pressed ? EVENT_LOG_PRESSED : 0;
+  if (IS_QK_MOD_TAP(keycode) || IS_QK_LAYER_TAP(keycode)) {
+    r->flags |= EVENT_LOG_TAP_HOLD | (record->tap.count ? EVENT_LOG_TAP : 0);
+  }
+  if (IS_COMBOEVENT(record->event)) {
+    r->flags |= EVENT_LOG_COMBO;
+  }
+}
+
+/** Writes `value` as `num_digits` hex digits to `dest`. */
+static char* write_hex(char* dest, uint16_t value, uint8_t num_digits) {
+  for (int8_t i = num_digits - 1; i >= 0; --i, value >>= 4) {
+    const uint8_t digit = value & 15;
+    dest[i] = (digit < 10) ? ('0' + digit) : ('a' - 10 + digit);
+  }
+  return dest + num_digits;
+}
+
+static void write_record(const event_log_record_t* r) {
+  char line[sizeof(EVENT_LOG_PREFIX) + 16];
+  char* p = line;
+  memcpy(p, EVENT_LOG_PREFIX, sizeof(EVENT_LOG_PREFIX) - 1);
+  p += sizeof(EVENT_LOG_PREFIX) - 1;
+  p = write_hex(p, r->time, 4);
+  p = write_hex(p, r->keycode, 4);
+  p = write_hex(p, r->row, 2);
+  p = write_hex(p, r->col, 2);
+  p = write_hex(p, r->layer, 2);
+  p = write_hex(p, r->flags, 2);
+  *p = '\0';
+  xprintf("%s\n", line);
+}
+
+void event_log_task(void) {
+  for (uint8_t i = 0; i < EVENT_LOG_FLUSH_COUNT && head != tail; ++i) {
+    write_record(&ring[tail++ & (EVENT_LOG_SIZE - 1)]);
+  }
+
+  if (num_dropped && head == tail) {
+    const event_log_record_t dropped = {
+        .time = timer_read(),
+        .keycode = num_dropped,
+        .flags = EVENT_LOG_DROPPED,
+    };
+    write_record(&dropped);
+    num_dropped = 0;
+  }
+}
+
+#endif  // EVENT_LOG_ENABLE
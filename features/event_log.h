@@ -0,0 +1,126 @@
+// Copyright 2026 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file event_log.h
+ * @brief Event Log - binary key event log, decoded on the host
+ *
+ * Overview
+ * --------
+ *
+ * Logging each key event with xprintf() and get_keycode_string() formats text
+ * on the keyboard, in process_record_user(), on every press and release. Event
+ * Log instead packs the event into an 8-byte record in a RAM ring buffer. From
+ * housekeeping, records are written to the console as short hex lines like
+ *
+ *     @ev 1b2b000402030001
+ *
+ * and a host tool turns them back into text using keycode_string's tables:
+ *
+ *     6955 L0  ( 2, 3)      press   KC_A
+ *
+ * Formatting then costs nothing on the keyboard, so that logging may stay on
+ * without perturbing timing.
+ *
+ *
+ * Add it to your keymap
+ * ---------------------
+ *
+ * In rules.mk, set `EVENT_LOG_ENABLE = yes` and `CONSOLE_ENABLE = yes`. Then
+ * in keymap.c, add
+ *
+ *     #include "features/event_log.h"
+ *
+ *     bool process_record_user(uint16_t keycode, keyrecord_t* record) {
+ *       event_log_record(keycode, record);
+ *       // Macros...
+ *       return true;
+ *     }
+ *
+ *     void housekeeping_task_user(void) {
+ *       event_log_task();
+ *       // Other tasks...
+ *     }
+ *
+ * Events are recorded while `debug_enable` is set. The ring holds
+ * `EVENT_LOG_SIZE` records (default 16, a power of 2), and each call to
+ * event_log_task() writes `EVENT_LOG_FLUSH_COUNT` of them (default 1). If the
+ * ring is full, new events are dropped and counted, and a record of the count
+ * is written once there is space.
+ *
+ * To decode, pipe the console through tools/qmk_sim/event_log_decode, built
+ * with `make -C tools/qmk_sim event_log_decode`. It links the keymap, so that
+ * custom keycodes are named as in KEYCODE_STRING_NAMES_USER. Lines other than
+ * records are passed through unchanged:
+ *
+ *     qmk console | tools/qmk_sim/event_log_decode
+ *
+ * Record format
+ * -------------
+ *
+ * A record line is "@ev " followed by 16 hex digits, for the fields
+ *
+ *     time (4), keycode (4), row (2), col (2), layer (2), flags (2)
+ *
+ * where time is the 16-bit event time in ms and flags are `EVENT_LOG_*` bits.
+ */
+
+#pragma once
+
+#include "quantum.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Prefix of record lines. */
+#define EVENT_LOG_PREFIX "@ev "
+
+/** Bits of the record flags. */
+enum event_log_flags {
+  EVENT_LOG_PRESSED = 1,
+  EVENT_LOG_TAP_HOLD = 2,  // MT or LT key.
+  EVENT_LOG_TAP = 4,       // Tap-hold key settled as tapped.
+  EVENT_LOG_COMBO = 8,     // Combo event; row and col are meaningless.
+  EVENT_LOG_DROPPED = 128, // Count of dropped events, in the keycode field.
+};
+
+/** Packed event record. */
+typedef struct {
+  uint16_t time;
+  uint16_t keycode;
+  uint8_t row;
+  uint8_t col;
+  uint8_t layer;
+  uint8_t flags;
+} event_log_record_t;
+
+#ifdef EVENT_LOG_ENABLE
+
+/** Records a key event. Call from process_record_user(). */
+void event_log_record(uint16_t keycode, keyrecord_t* record);
+
+/** Writes pending records to the console. Call from housekeeping. */
+void event_log_task(void);
+
+#else
+
+static inline void event_log_record(uint16_t keycode, keyrecord_t* record) {}
+static inline void event_log_task(void) {}
+
+#endif  // EVENT_LOG_ENABLE
+
+#ifdef __cplusplus
+}
+#endif
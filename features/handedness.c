@@ -0,0 +1,70 @@
+// Copyright 2026 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file handedness.c
+ * @brief Handedness implementation
+ */
+
+#include "handedness.h"
+
+#ifndef CHORDAL_HOLD
+// Declared by QMK core only with Chordal Hold enabled.
+extern const char chordal_hold_layout[MATRIX_ROWS][MATRIX_COLS] PROGMEM;
+#endif  // CHORDAL_HOLD
+
+// Bit `col` of `left_hand[row]` is set if the key is 'L', likewise for 'R'.
+static matrix_row_t left_hand[MATRIX_ROWS];
+static matrix_row_t right_hand[MATRIX_ROWS];
+
+void handedness_init(void) {
+  for (uint8_t row = 0; row < MATRIX_ROWS; ++row) {
+    matrix_row_t left = 0;
+    matrix_row_t right = 0;
+    for (uint8_t col = 0; col < MATRIX_COLS; ++col) {
+      const char hand = (char)pgm_read_byte(&chordal_hold_layout[row][col]);
+      if (hand == 'L') {
+        left |= (matrix_row_t)1 << col;
+      } else if (hand == 'R') {
+        right |= (matrix_row_t)1 << col;
+      }
+    }
+    left_hand[row] = left;
+    right_hand[row] = right;
+  }
+}
+
+char handedness_get(keypos_t pos) {
+  if ((left_hand[pos.row] >> pos.col) & 1) {
+    return 'L';
+  } else if ((right_hand[pos.row] >> pos.col) & 1) {
+    return 'R';
+  }
+  return '*';
+}
+
+bool handedness_same_hand(keypos_t a, keypos_t b) {
+  return ((left_hand[a.row] >> a.col) & (left_hand[b.row] >> b.col) & 1) |
+         ((right_hand[a.row] >> a.col) & (right_hand[b.row] >> b.col) & 1);
+}
+
+bool handedness_chordal_hold(const keyrecord_t* tap_hold_record,
+                             const keyrecord_t* other_record) {
+  if (!IS_KEYEVENT(tap_hold_record->event) ||
+      !IS_KEYEVENT(other_record->event)) {
+    return true;  // Return true on combos or other non-key events.
+  }
+  return !handedness_same_hand(tap_hold_record->event.key,
+                               other_record->event.key);
+}
@@ -0,0 +1,86 @@
+// Copyright 2026 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file handedness.h
+ * @brief Handedness - which hand each key belongs to, by bitmap lookup
+ *
+ * Overview
+ * --------
+ *
+ * Chordal Hold and Achordion decide tap vs. hold by whether two keys are on
+ * the same hand. Handedness keeps that information as a bitmap per matrix
+ * row for each hand, built once from the keymap's `chordal_hold_layout`, so
+ * that the same-hand check for a pair of keys is a couple of bit tests. As in
+ * `chordal_hold_layout`, each key is 'L' for the left hand, 'R' for the right
+ * hand, or '*' for keys that may chord with either hand, like thumb keys.
+ *
+ * Compared to guessing from the matrix dimensions, as Achordion does by
+ * default, this is correct on any board, e.g. on the Dactyl, whose thumb
+ * clusters are wired as extra matrix rows.
+ *
+ *
+ * Add it to your keymap
+ * ---------------------
+ *
+ * In rules.mk, set `HANDEDNESS_ENABLE = yes`. Define `chordal_hold_layout` in
+ * keymap.c as for Chordal Hold (<https://docs.qmk.fm/tap_hold#chordal-hold>),
+ * then add
+ *
+ *     #include "features/handedness.h"
+ *
+ *     void keyboard_post_init_user(void) {
+ *       handedness_init();
+ *     }
+ *
+ *     bool get_chordal_hold(uint16_t tap_hold_keycode,
+ *                           keyrecord_t* tap_hold_record,
+ *                           uint16_t other_keycode,
+ *                           keyrecord_t* other_record) {
+ *       return handedness_chordal_hold(tap_hold_record, other_record);
+ *     }
+ *
+ * `handedness_chordal_hold()` is equivalent to `get_chordal_hold_default()`.
+ * When `HANDEDNESS_ENABLE` is defined, `achordion_opposite_hands()` in
+ * achordion.c uses the same bitmaps.
+ */
+
+#pragma once
+
+#include "quantum.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Builds the bitmaps from `chordal_hold_layout`. Call once at init. */
+void handedness_init(void);
+
+/** Returns 'L', 'R', or '*' for the key at `pos`. */
+char handedness_get(keypos_t pos);
+
+/** Returns true if both keys are 'L' or both are 'R'. */
+bool handedness_same_hand(keypos_t a, keypos_t b);
+
+/**
+ * Returns whether a tap-hold key may be settled as held when the other key is
+ * pressed, like `get_chordal_hold_default()`: true for combos and other
+ * non-key events, and otherwise unless the keys are on the same hand.
+ */
+bool handedness_chordal_hold(const keyrecord_t* tap_hold_record,
+                             const keyrecord_t* other_record);
+
+#ifdef __cplusplus
+}
+#endif
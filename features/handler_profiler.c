@@ -0,0 +1,159 @@
+// Copyright 2026 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file handler_profiler.c
+ * @brief Handler Profiler implementation
+ *
+ * Each handler has a histogram of costs with two buckets per power of two, so
+ * that the 99th percentile is found within a factor of 1.5 without storing
+ * individual measurements.
+ */
+
+#include "handler_profiler.h"
+
+#ifdef HANDLER_PROFILER_ENABLE
+
+#ifndef HANDLER_PROFILER_REPORT_INTERVAL
+#define HANDLER_PROFILER_REPORT_INTERVAL 10000
+#endif  // HANDLER_PROFILER_REPORT_INTERVAL
+
+// Costs of 2^24 or more fall in the last bucket.
+#define NUM_BUCKETS 48
+
+#if defined(__CHIBIOS__)
+#define COST_UNITS "cycles"
+#else
+#define COST_UNITS "ns"
+#endif
+
+static const char* const handler_names[HANDLER_PROFILER_NUM_HANDLERS] = {
+    [PROFILE_PROCESS_RECORD_USER] = "process_record_user",
+    [PROFILE_ACHORDION] = "achordion",
+    [PROFILE_AUTOCORRECTION] = "autocorrection",
+    [PROFILE_SENTENCE_CASE] = "sentence_case",
+    [PROFILE_CAPS_WORD] = "caps_word",
+    [PROFILE_REPEAT_KEY] = "repeat_key",
+    [PROFILE_CUSTOM_SHIFT_KEYS] = "custom_shift_keys",
+    [PROFILE_SELECT_WORD] = "select_word",
+    [PROFILE_LAYER_LOCK] = "layer_lock",
+    [PROFILE_ORBITAL_MOUSE] = "orbital_mouse",
+    [PROFILE_SOCD_CLEANER] = "socd_cleaner",
+    [PROFILE_KEY_CONTEXT] = "key_context",
+    [PROFILE_OUTPUT_QUEUE] = "output_queue",
+};
+
+static struct {
+  uint32_t count;
+  uint32_t min;
+  uint32_t max;
+  uint64_t sum;
+  uint16_t histogram[NUM_BUCKETS];
+} stats[HANDLER_PROFILER_NUM_HANDLERS];
+
+static bool updated = false;
+static uint32_t report_timer = 0;
+
+// Buckets are [0], [1], [2], [3], [4, 6), [6, 8), [8, 12), [12, 16), ...
+static uint8_t bucket_index(uint32_t cost) {
+  if (cost < 4) {
+    return cost;
+  }
+  const uint8_t octave = 31 - __builtin_clz(cost);
+  const uint8_t i = 2 * octave + ((cost >> (octave - 1)) & 1);
+  return (i < NUM_BUCKETS) ? i : NUM_BUCKETS - 1;
+}
+
+// Returns the exclusive upper bound of bucket i.
+static uint32_t bucket_upper(uint8_t i) {
+  if (i < 4) {
+    return i + 1;
+  }
+  const uint8_t octave = i / 2;
+  return (UINT32_C(3) + (i & 1)) << (octave - 1);
+}
+
+void handler_profiler_init(void) {
+#if defined(__CHIBIOS__)
+  CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+  DWT->CYCCNT = 0;
+  DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+#endif
+  handler_profiler_reset();
+}
+
+void handler_profiler_reset(void) {
+  memset(stats, 0, sizeof(stats));
+  updated = false;
+}
+
+void handler_profiler_record(uint8_t id, uint32_t cost) {
+  if (id >= HANDLER_PROFILER_NUM_HANDLERS) {
+    return;
+  }
+  if (!stats[id].count || cost < stats[id].min) {
+    stats[id].min = cost;
+  }
+  if (cost > stats[id].max) {
+    stats[id].max = cost;
+  }
+  ++stats[id].count;
+  stats[id].sum += cost;
+  uint16_t* bucket = &stats[id].histogram[bucket_index(cost)];
+  if (*bucket < UINT16_MAX) {
+    ++*bucket;
+  }
+  updated = true;
+}
+
+// Estimates the 99th percentile from the histogram.
+static uint32_t p99(uint8_t id) {
+  const uint32_t target = stats[id].count - stats[id].count / 100;
+  uint32_t total = 0;
+  for (uint8_t i = 0; i < NUM_BUCKETS; ++i) {
+    total += stats[id].histogram[i];
+    if (total >= target) {
+      const uint32_t upper = bucket_upper(i) - 1;
+      return (upper < stats[id].max) ? upper : stats[id].max;
+    }
+  }
+  return stats[id].max;
+}
+
+void handler_profiler_report(void) {
+  uprintf("handler_profiler: cost in " COST_UNITS "\n");
+  uprintf("%-20s %8s %8s %8s %8s %8s\n", "handler", "calls", "min", "mean",
+          "max", "p99");
+  for (uint8_t id = 0; id < HANDLER_PROFILER_NUM_HANDLERS; ++id) {
+    const uint32_t count = stats[id].count;
+    if (!count) {
+      continue;
+    }
+    uprintf("%-20s %8lu %8lu %8lu %8lu %8lu\n", handler_names[id],
+            (unsigned long)count, (unsigned long)stats[id].min,
+            (unsigned long)(stats[id].sum / count),
+            (unsigned long)stats[id].max, (unsigned long)p99(id));
+  }
+}
+
+void handler_profiler_task(void) {
+  if (updated && timer_elapsed32(report_timer) >=
+                     HANDLER_PROFILER_REPORT_INTERVAL) {
+    handler_profiler_report();
+    updated = false;
+    report_timer = timer_read32();
+  }
+}
+
+#endif  // HANDLER_PROFILER_ENABLE
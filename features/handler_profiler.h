@@ -0,0 +1,147 @@
+// Copyright 2026 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file handler_profiler.h
+ * @brief Handler profiler - measure the cost of each process_record handler
+ *
+ * Overview
+ * --------
+ *
+ * Every key event runs through a chain of handlers: process_record_user(),
+ * process_achordion(), process_autocorrection(), and so on. Handler Profiler
+ * measures the cost of each call and reports min, mean, max, and 99th
+ * percentile per handler through the console.
+ *
+ * Costs are in CPU cycles on ChibiOS boards, read from the Cortex-M DWT cycle
+ * counter, and in nanoseconds in the host simulator under tools/qmk_sim. AVR
+ * has no cycle counter and is not supported.
+ *
+ *
+ * Add it to your keymap
+ * ---------------------
+ *
+ * In rules.mk, set `HANDLER_PROFILER_ENABLE = yes` and `CONSOLE_ENABLE = yes`.
+ * Then wrap each handler call to be profiled with `PROFILE_HANDLER()`:
+ *
+ *     #include "features/handler_profiler.h"
+ *
+ *     bool process_record_user(uint16_t keycode, keyrecord_t* record) {
+ *       if (!PROFILE_HANDLER(PROFILE_ACHORDION,
+ *                            process_achordion(keycode, record))) {
+ *         return false;
+ *       }
+ *       // Other handlers...
+ *       return true;
+ *     }
+ *
+ * Or to profile a block of code, use `HANDLER_PROFILER_BEGIN()` at the start
+ * of the block and `HANDLER_PROFILER_END(id)` at the end. Call
+ * `handler_profiler_init()` from keyboard_post_init_user() and
+ * `handler_profiler_task()` from housekeeping_task_user(). Stats are printed to
+ * the console every `HANDLER_PROFILER_REPORT_INTERVAL` ms while there are new
+ * measurements.
+ *
+ * When HANDLER_PROFILER_ENABLE is not defined, the macros reduce to the wrapped
+ * call and the functions to empty inlines, so instrumentation costs nothing.
+ */
+
+#pragma once
+
+#include "quantum.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Handlers that may be profiled. */
+enum handler_profiler_ids {
+  PROFILE_PROCESS_RECORD_USER,
+  PROFILE_ACHORDION,
+  PROFILE_AUTOCORRECTION,
+  PROFILE_SENTENCE_CASE,
+  PROFILE_CAPS_WORD,
+  PROFILE_REPEAT_KEY,
+  PROFILE_CUSTOM_SHIFT_KEYS,
+  PROFILE_SELECT_WORD,
+  PROFILE_LAYER_LOCK,
+  PROFILE_ORBITAL_MOUSE,
+  PROFILE_SOCD_CLEANER,
+  PROFILE_KEY_CONTEXT,
+  PROFILE_OUTPUT_QUEUE,
+  HANDLER_PROFILER_NUM_HANDLERS,
+};
+
+#ifdef HANDLER_PROFILER_ENABLE
+
+#if defined(__CHIBIOS__)
+/** Reads the DWT cycle counter. */
+static inline uint32_t handler_profiler_now(void) { return DWT->CYCCNT; }
+#elif defined(__AVR__)
+#error "handler_profiler: AVR has no cycle counter. Please disable."
+#else
+#include <time.h>
+/** Reads a monotonic host clock in nanoseconds. */
+static inline uint32_t handler_profiler_now(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint32_t)ts.tv_sec * UINT32_C(1000000000) + (uint32_t)ts.tv_nsec;
+}
+#endif
+
+/** Enables the cycle counter. Call from keyboard_post_init_user(). */
+void handler_profiler_init(void);
+
+/** Periodically prints stats. Call from housekeeping_task_user(). */
+void handler_profiler_task(void);
+
+/** Records one measurement of `cost` for handler `id`. */
+void handler_profiler_record(uint8_t id, uint32_t cost);
+
+/** Prints min, mean, max, and p99 of each profiled handler. */
+void handler_profiler_report(void);
+
+/** Clears all measurements. */
+void handler_profiler_reset(void);
+
+/** Calls `call`, a bool expression, recording its cost under `id`. */
+#define PROFILE_HANDLER(id, call)                                       \
+  ({                                                                    \
+    const uint32_t handler_profiler_start_ = handler_profiler_now();   \
+    const bool handler_profiler_result_ = (call);                       \
+    handler_profiler_record((id), handler_profiler_now() -              \
+                                      handler_profiler_start_);         \
+    handler_profiler_result_;                                           \
+  })
+
+#define HANDLER_PROFILER_BEGIN() \
+  const uint32_t handler_profiler_start_ = handler_profiler_now()
+#define HANDLER_PROFILER_END(id) \
+  handler_profiler_record((id), handler_profiler_now() - handler_profiler_start_)
+
+#else
+
+static inline void handler_profiler_init(void) {}
+static inline void handler_profiler_task(void) {}
+static inline void handler_profiler_report(void) {}
+static inline void handler_profiler_reset(void) {}
+#define PROFILE_HANDLER(id, call) (call)
+#define HANDLER_PROFILER_BEGIN()
+#define HANDLER_PROFILER_END(id)
+
+#endif  // HANDLER_PROFILER_ENABLE
+
+#ifdef __cplusplus
+}
+#endif
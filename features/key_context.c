@@ -0,0 +1,142 @@
+// Copyright 2026 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file key_context.c
+ * @brief Key Context implementation
+ */
+
+#include "key_context.h"
+
+#include <string.h>
+
+#ifdef KEY_CONTEXT_ENABLE
+
+#if KEY_CONTEXT_BUFFER_SIZE < 1 || KEY_CONTEXT_BUFFER_SIZE > 128
+#error "key_context: KEY_CONTEXT_BUFFER_SIZE must be between 1 and 128"
+#endif
+
+// Ring buffer of the last KEY_CONTEXT_BUFFER_SIZE typed keys, the latest at
+// `head`. As in sentence_case.c, each key is stored twice, at `head` and at
+// `head + KEY_CONTEXT_BUFFER_SIZE`, so that the keys in order from oldest to
+// latest are always contiguous, starting at `buffer + head + 1`.
+static uint16_t buffer[2 * KEY_CONTEXT_BUFFER_SIZE] = {0};
+static uint8_t head = 0;
+static uint16_t current_keycode = KC_NO;
+// The last event and keycode processed, so that each is processed once.
+static keyevent_t last_event = {0};
+static uint16_t last_keycode = KC_NO;
+
+/** Sets the key at `head` in both halves of the ring. */
+static void set_key(uint16_t keycode) {
+  buffer[head] = keycode;
+  buffer[head + KEY_CONTEXT_BUFFER_SIZE] = keycode;
+}
+
+static void push_key(uint16_t keycode) {
+  if (++head >= KEY_CONTEXT_BUFFER_SIZE) {
+    head = 0;
+  }
+  set_key(keycode);
+}
+
+static void pop_key(void) {
+  set_key(KC_NO);
+  head = (head ? head : KEY_CONTEXT_BUFFER_SIZE) - 1;
+}
+
+/** Gets the keycode that the press types, or KC_NO if it is a held key. */
+static uint16_t normalize_keycode(uint16_t keycode, keyrecord_t* record) {
+  switch (keycode) {
+    // Repeat Key and Alt Repeat Key process the event again with the keycode
+    // that they type, which is pushed then.
+    case QK_REPEAT_KEY:
+    case QK_ALT_REPEAT_KEY:
+      return KC_NO;
+#ifndef NO_ACTION_TAPPING
+    case QK_MOD_TAP ... QK_MOD_TAP_MAX:
+      return record->tap.count ? QK_MOD_TAP_GET_TAP_KEYCODE(keycode) : KC_NO;
+#ifndef NO_ACTION_LAYER
+    case QK_LAYER_TAP ... QK_LAYER_TAP_MAX:
+      return record->tap.count ? QK_LAYER_TAP_GET_TAP_KEYCODE(keycode) : KC_NO;
+#endif  // NO_ACTION_LAYER
+#endif  // NO_ACTION_TAPPING
+#ifdef SWAP_HANDS_ENABLE
+    case QK_SWAP_HANDS ... QK_SWAP_HANDS_MAX:
+      return (IS_SWAP_HANDS_KEYCODE(keycode) || record->tap.count == 0)
+                 ? KC_NO
+                 : QK_SWAP_HANDS_GET_TAP_KEYCODE(keycode);
+#endif  // SWAP_HANDS_ENABLE
+  }
+  return keycode;
+}
+
+/** Whether `keycode` types something, as opposed to a mod or layer key. */
+static bool is_typed_key(uint16_t keycode) {
+  switch (keycode) {
+    case KC_NO:
+    case KC_CAPS:
+    case KC_LCTL ... KC_RGUI:
+    case QK_ONE_SHOT_MOD ... QK_ONE_SHOT_MOD_MAX:
+    case QK_TO ... QK_TO_MAX:
+    case QK_MOMENTARY ... QK_MOMENTARY_MAX:
+    case QK_DEF_LAYER ... QK_DEF_LAYER_MAX:
+    case QK_TOGGLE_LAYER ... QK_TOGGLE_LAYER_MAX:
+    case QK_ONE_SHOT_LAYER ... QK_ONE_SHOT_LAYER_MAX:
+    case QK_LAYER_TAP_TOGGLE ... QK_LAYER_TAP_TOGGLE_MAX:
+    case QK_LAYER_MOD ... QK_LAYER_MOD_MAX:
+#ifdef TRI_LAYER_ENABLE
+    case QK_TRI_LAYER_LOWER:
+    case QK_TRI_LAYER_UPPER:
+#endif  // TRI_LAYER_ENABLE
+      return false;
+  }
+  return true;
+}
+
+bool process_key_context(uint16_t keycode, keyrecord_t* record) {
+  if (!record->event.pressed ||
+      (last_event.pressed && record->event.time == last_event.time &&
+       KEYEQ(record->event.key, last_event.key) && keycode == last_keycode)) {
+    return true;
+  }
+  last_event = record->event;
+  last_keycode = keycode;
+
+  current_keycode = normalize_keycode(keycode, record);
+  if (current_keycode == KC_BSPC) {
+    pop_key();
+  } else if (is_typed_key(current_keycode)) {
+#ifndef NO_ACTION_ONESHOT
+    const uint8_t mods = get_mods() | get_oneshot_mods();
+#else
+    const uint8_t mods = get_mods();
+#endif  // NO_ACTION_ONESHOT
+    // A hotkey breaks the text.
+    push_key((mods & ~(MOD_MASK_SHIFT | MOD_BIT(KC_RALT))) ? KC_NO
+                                                           : current_keycode);
+  }
+  return true;
+}
+
+uint16_t get_key_context_keycode(void) { return current_keycode; }
+
+const uint16_t* get_key_context_buffer(void) { return buffer + head + 1; }
+
+void key_context_clear(void) {
+  memset(buffer, 0, sizeof(buffer));
+  head = 0;
+}
+
+#endif  // KEY_CONTEXT_ENABLE
@@ -0,0 +1,100 @@
+// Copyright 2026 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file key_context.h
+ * @brief Key Context - shared history of recently typed keys
+ *
+ * Overview
+ * --------
+ *
+ * Features that react to typing, like autocorrection and Sentence Case, each
+ * unpack the tap keycode of mod-tap and layer-tap keys, and each keep a buffer
+ * of recent keys. Key Context does this once per press: it normalizes the
+ * keycode and pushes it to a ring buffer shared by all of them.
+ *
+ * Per press, the normalized keycode is
+ *
+ *  - the tap keycode of a tapped mod-tap, layer-tap, or swap-hands key,
+ *  - KC_NO for a held tap-hold key, or for Repeat Key and Alt Repeat Key,
+ *    which are pushed as the key they type when it is processed,
+ *  - otherwise the keycode itself.
+ *
+ * The ring holds the last `KEY_CONTEXT_BUFFER_SIZE` typed keys (default 8).
+ * Modifiers, one-shot mods, layer switches, Caps Lock, and held tap-hold keys
+ * aren't typed keys, and are skipped. A key pressed with Ctrl, Alt, or GUI is
+ * a hotkey, which is pushed as KC_NO to mark a break in the text. Backspace
+ * removes the latest key.
+ *
+ *
+ * Add it to your keymap
+ * ---------------------
+ *
+ * In rules.mk, set `KEY_CONTEXT_ENABLE = yes`. Then in keymap.c, call
+ * process_key_context() before the features that read it:
+ *
+ *     #include "features/key_context.h"
+ *
+ *     bool process_record_user(uint16_t keycode, keyrecord_t* record) {
+ *       process_key_context(keycode, record);
+ *       if (!process_autocorrection(keycode, record)) { return false; }
+ *       // Macros...
+ *       return true;
+ *     }
+ *
+ * It processes each event once per keycode, so it is harmless if it is called
+ * for the same event again from another handler. An event processed again
+ * with a different keycode, as Repeat Key does, is processed anew.
+ */
+
+#pragma once
+
+#include "quantum.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifndef KEY_CONTEXT_BUFFER_SIZE
+#define KEY_CONTEXT_BUFFER_SIZE 8
+#endif  // KEY_CONTEXT_BUFFER_SIZE
+
+#ifdef KEY_CONTEXT_ENABLE
+
+/** Handler function for Key Context. Always returns true. */
+bool process_key_context(uint16_t keycode, keyrecord_t* record);
+
+/** Gets the normalized keycode of the current or last press. */
+uint16_t get_key_context_keycode(void);
+
+/**
+ * Gets the last `KEY_CONTEXT_BUFFER_SIZE` typed keys, from oldest to latest.
+ * The buffer is valid until the next press.
+ */
+const uint16_t* get_key_context_buffer(void);
+
+/** Clears the history of typed keys. */
+void key_context_clear(void);
+
+#else
+
+static inline bool process_key_context(uint16_t keycode, keyrecord_t* record) {
+  return true;
+}
+
+#endif  // KEY_CONTEXT_ENABLE
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,29 @@
+// Copyright 2026 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file keycode_class.c
+ * @brief Keycode Class implementation
+ */
+
+#include "keycode_class.h"
+
+#ifdef KEYCODE_CLASS_ENABLE
+
+// The default table. It is weak so that a keymap may define its own.
+__attribute__((weak)) const uint8_t keycode_classes[256] PROGMEM = {
+    KEYCODE_CLASS_DEFAULTS,
+};
+
+#endif  // KEYCODE_CLASS_ENABLE
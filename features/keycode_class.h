@@ -0,0 +1,134 @@
+// Copyright 2026 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file keycode_class.h
+ * @brief Keycode Class - table of class flags for basic keycodes
+ *
+ * Overview
+ * --------
+ *
+ * Callbacks like caps_word_press_user() and sentence_case_press_user() each
+ * classify keycodes with switches of case ranges, like `KC_A ... KC_Z`. This
+ * library instead defines one PROGMEM table with a byte of `KCC_*` flags for
+ * each of the 256 basic keycodes, so that each question is answered with one
+ * load and a mask:
+ *
+ *     if (get_keycode_class(keycode, mods) & KCC_ENDING) {
+ *       // Sentence-ending punctuation.
+ *     }
+ *
+ * Shift matters to some classes: "1" is a digit, but "!" ends a sentence. The
+ * table has a flag for each of these when shifted, and get_keycode_class()
+ * returns the flags for the key as typed. A key is shifted if `mods` include
+ * Shift or if the keycode is a shifted keycode like `KC_EXLM`.
+ *
+ *
+ * Add it to your keymap
+ * ---------------------
+ *
+ * In rules.mk, set `KEYCODE_CLASS_ENABLE = yes`. Then in keymap.c, add
+ *
+ *     #include "features/keycode_class.h"
+ *
+ * and call get_keycode_class() as above. To customize the classes, define the
+ * table in keymap.c, listing the defaults followed by your edits:
+ *
+ *     const uint8_t keycode_classes[256] PROGMEM = {
+ *         KEYCODE_CLASS_DEFAULTS,
+ *         // Shift + comma is '?' on this keymap.
+ *         [KC_COMM] = KCC_WORD_BREAK | KCC_SYMBOL | KCC_SHIFTED_ENDING,
+ *     };
+ *
+ * Autocorrection and Achordion's streak check read the table when
+ * `KEYCODE_CLASS_ENABLE` is defined.
+ */
+
+#pragma once
+
+#include "quantum.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Class flags of a keycode. */
+enum keycode_class_flags {
+  /** Letter, A-Z. */
+  KCC_LETTER = 1,
+  /** Ends a word for autocorrection, like space and punctuation. */
+  KCC_WORD_BREAK = 2,
+  /** Ends a sentence, like '.'. */
+  KCC_ENDING = 4,
+  /** Ends a sentence when shifted, like '!' on KC_1. */
+  KCC_SHIFTED_ENDING = 8,
+  /** Types a symbol or digit that isn't part of a word. */
+  KCC_SYMBOL = 16,
+  /** Continues Caps Word. */
+  KCC_CAPS_WORD = 32,
+  /** Continues Caps Word when shifted, like '_' on KC_MINS. */
+  KCC_SHIFTED_CAPS_WORD = 64,
+  /** Continues an Achordion typing streak. */
+  KCC_STREAK = 128,
+};
+
+// clang-format off
+/** Default classes, as designated initializers for the table. */
+#define KEYCODE_CLASS_DEFAULTS                                              \
+  [KC_A ... KC_Z] = KCC_LETTER | KCC_STREAK,                                \
+  [KC_1] = KCC_WORD_BREAK | KCC_SYMBOL | KCC_CAPS_WORD | KCC_SHIFTED_ENDING, \
+  [KC_2 ... KC_0] = KCC_WORD_BREAK | KCC_SYMBOL | KCC_CAPS_WORD,            \
+  [KC_ENT] = KCC_WORD_BREAK,                                                \
+  [KC_BSPC] = KCC_WORD_BREAK | KCC_CAPS_WORD,                               \
+  [KC_TAB] = KCC_WORD_BREAK,                                                \
+  [KC_SPC] = KCC_WORD_BREAK | KCC_STREAK,                                   \
+  [KC_MINS] = KCC_WORD_BREAK | KCC_SYMBOL | KCC_CAPS_WORD |                 \
+              KCC_SHIFTED_CAPS_WORD,                                        \
+  [KC_EQL ... KC_SCLN] = KCC_WORD_BREAK | KCC_SYMBOL,                       \
+  [KC_QUOT] = KCC_WORD_BREAK | KCC_STREAK,                                  \
+  [KC_GRV] = KCC_WORD_BREAK | KCC_SYMBOL,                                   \
+  [KC_COMM] = KCC_WORD_BREAK | KCC_SYMBOL | KCC_STREAK,                     \
+  [KC_DOT] = KCC_WORD_BREAK | KCC_SYMBOL | KCC_ENDING | KCC_STREAK,         \
+  [KC_SLSH] = KCC_WORD_BREAK | KCC_SYMBOL | KCC_SHIFTED_ENDING,             \
+  [KC_DEL] = KCC_CAPS_WORD
+// clang-format on
+
+/** Table of class flags, indexed by basic keycode. */
+extern const uint8_t keycode_classes[256] PROGMEM;
+
+/**
+ * Gets the class flags of `keycode` as typed with `mods`.
+ *
+ * `keycode` is a basic keycode or a shifted one, like `KC_EXLM`; other
+ * keycodes have no classes. When shifted, the returned KCC_ENDING and
+ * KCC_CAPS_WORD flags are the table's KCC_SHIFTED_ENDING and
+ * KCC_SHIFTED_CAPS_WORD. The KCC_SHIFTED_* flags are never returned.
+ */
+static inline uint8_t get_keycode_class(uint16_t keycode, uint8_t mods) {
+  bool shifted = (mods & MOD_MASK_SHIFT) != 0;
+  if (IS_QK_MODS(keycode) && (QK_MODS_GET_MODS(keycode) & 0x0f) == MOD_LSFT) {
+    shifted = true;
+    keycode = QK_MODS_GET_BASIC_KEYCODE(keycode);
+  } else if (keycode > 0xff) {
+    return 0;
+  }
+  const uint8_t flags = pgm_read_byte(keycode_classes + keycode);
+  const uint8_t unshifted = KCC_ENDING | KCC_CAPS_WORD;
+  return (flags & ~(unshifted | (unshifted << 1))) |
+         (shifted ? (flags >> 1) & unshifted : flags & unshifted);
+}
+
+#ifdef __cplusplus
+}
+#endif
@@ -142,34 +142,20 @@ __attribute__((weak)) const keycode_string_name_t* keycode_string_names_data_use
 __attribute__((weak)) uint16_t keycode_string_names_size_user = 0;
 /** Names of the 4 mods on each hand. */
 static const char mod_names[] PROGMEM = "CTL\0SFT\0ALT\0GUI";
-/** Internal buffer for holding a stringified keycode. */
+/** Internal buffer for get_keycode_string(). */
 static char buffer[32];
-#define BUFFER_MAX_LEN (sizeof(buffer) - 1)
-static index_t buffer_len;
 
-/** Finds the name of a keycode in `common_names` or returns NULL. */
-static const char* search_common_names(uint16_t keycode) {
-  static uint8_t buffer[8];
-
-  for (int_fast16_t offset = 0; offset < ARRAY_SIZE(common_names); offset += 4) {
-    if (keycode == pgm_read_word(common_names + offset)) {
-      const uint16_t w0 = pgm_read_word(common_names + offset + 1);
-      const uint16_t w1 = pgm_read_word(common_names + offset + 2);
-      const uint16_t w2 = pgm_read_word(common_names + offset + 3);
-      buffer[0] = (uint8_t)w0;
-      buffer[1] = (uint8_t)(w0 >> 8);
-      buffer[2] = '_';
-      buffer[3] = (uint8_t)w1;
-      buffer[4] = (uint8_t)(w1 >> 8);
-      buffer[5] = (uint8_t)w2;
-      buffer[6] = (uint8_t)(w2 >> 8);
-      buffer[7] = 0;
-      return (const char*)buffer;
-    }
-  }
-
-  return NULL;
-}
+/**
+ * @brief Destination of a stringified keycode.
+ *
+ * All formatting state lives here, in the caller's stack frame, so that
+ * keycodes may be formatted concurrently into separate buffers.
+ */
+typedef struct {
+  char* dest;
+  uint8_t len;
+  uint8_t max_len;  // Size of `dest` minus 1 for the null terminator.
+} writer_t;
 
 /**
  * @brief Finds the name of a keycode in table or returns NULL.
@@ -190,101 +176,121 @@ static const char* search_table(
   return NULL;
 }
 
-/** Formats `number` in `base`, either 10 or 16. */
-static char* number_string(uint16_t number, int8_t base) {
-  static char result[7];
-  result[sizeof(result) - 1] = '\0';
-  index_t i = sizeof(result) - 1;
-  do {
-    const uint8_t digit = number % base;
-    number /= base;
-    result[--i] = (digit < 10) ? (char)(digit + UINT8_C('0'))
-                               : (char)(digit + (UINT8_C('A') - 10));
-  } while (number > 0 && i > 0);
-
-  if (base == 16 && i >= 2) {
-    result[--i] = 'x';
-    result[--i] = '0';
-  }
-  return result + i;
-}
-
-/** Appends `str` to `buffer`, truncating if the result would overflow. */
-static void append(const char* str) {
-  char* dest = buffer + buffer_len;
-  index_t i;
-  for (i = 0; buffer_len + i < BUFFER_MAX_LEN && str[i]; ++i) {
+/** Appends `str`, truncating if the result would overflow. */
+static void append(writer_t* w, const char* str) {
+  char* dest = w->dest + w->len;
+  uint8_t i;
+  for (i = 0; w->len + i < w->max_len && str[i]; ++i) {
     dest[i] = str[i];
   }
-  buffer_len += i;
-  buffer[buffer_len] = '\0';
+  w->len += i;
+  w->dest[w->len] = '\0';
 }
 
 /** Same as append(), but where `str` is a PROGMEM string. */
-static void append_P(const char* str) {
-  char* dest = buffer + buffer_len;
-  index_t i;
-  for (i = 0; buffer_len + i < BUFFER_MAX_LEN; ++i) {
+static void append_P(writer_t* w, const char* str) {
+  char* dest = w->dest + w->len;
+  uint8_t i;
+  for (i = 0; w->len + i < w->max_len; ++i) {
     const char c = pgm_read_byte(&str[i]);
     if (c == '\0') {
       break;
     }
     dest[i] = c;
   }
-  buffer_len += i;
-  buffer[buffer_len] = '\0';
+  w->len += i;
+  w->dest[w->len] = '\0';
 }
 
-/** Appends a single char to `buffer` if there is space. */
-static void append_char(char c) {
-  if (buffer_len < BUFFER_MAX_LEN) {
-    buffer[buffer_len] = c;
-    buffer[++buffer_len] = '\0';
+/** Appends a single char if there is space. */
+static void append_char(writer_t* w, char c) {
+  if (w->len < w->max_len) {
+    w->dest[w->len] = c;
+    w->dest[++w->len] = '\0';
   }
 }
 
-/** Formats `number` in `base`, either 10 or 16, and appends it to `buffer`. */
-static void append_number(uint16_t number, int8_t base) {
-  append(number_string(number, base));
+/**
+ * @brief Appends the name of `keycode` from `common_names`, if it has one.
+ * @return True if the keycode was found.
+ */
+static bool append_common_name(writer_t* w, uint16_t keycode) {
+  for (int_fast16_t offset = 0; offset < ARRAY_SIZE(common_names); offset += 4) {
+    if (keycode == pgm_read_word(common_names + offset)) {
+      // Read the name bytewise. The words are little endian, as on AVR and ARM,
+      // so the bytes come out in the order KEYCODE_NAME7() was given them.
+      const uint8_t* name = (const uint8_t*)(common_names + offset + 1);
+      for (index_t i = 0; i < 6; ++i) {
+        const char c = pgm_read_byte(name + i);
+        if (c == '\0') {
+          break;
+        }
+        append_char(w, c);
+        if (i == 1) {  // The underscore after the prefix is not stored.
+          append_char(w, '_');
+        }
+      }
+      return true;
+    }
+  }
+  return false;
+}
+
+/** Formats `number` in `base`, either 10 or 16, and appends it. */
+static void append_number(writer_t* w, uint16_t number, int8_t base) {
+  char result[7];
+  result[sizeof(result) - 1] = '\0';
+  index_t i = sizeof(result) - 1;
+  do {
+    const uint8_t digit = number % base;
+    number /= base;
+    result[--i] = (digit < 10) ? (char)(digit + UINT8_C('0'))
+                               : (char)(digit + (UINT8_C('A') - 10));
+  } while (number > 0 && i > 0);
+
+  if (base == 16 && i >= 2) {
+    result[--i] = 'x';
+    result[--i] = '0';
+  }
+  append(w, result + i);
 }
 
-/** Stringifies 5-bit mods and appends it to `buffer`. */
-static void append_5_bit_mods(uint8_t mods) {
+/** Stringifies 5-bit mods and appends it. */
+static void append_5_bit_mods(writer_t* w, uint8_t mods) {
   const bool is_rhs = mods > 15;
   const uint8_t csag = mods & 15;
   if (csag != 0 && (csag & (csag - 1)) == 0) { // One mod is set.
-    append_P(PSTR("MOD_"));
-    append_char(is_rhs ? 'R' : 'L');
-    append_P(&mod_names[4 * biton(csag)]);
+    append_P(w, PSTR("MOD_"));
+    append_char(w, is_rhs ? 'R' : 'L');
+    append_P(w, &mod_names[4 * biton(csag)]);
   } else { // Fallback: write the mod as a hex value.
-    append_number(mods, 16);
+    append_number(w, mods, 16);
   }
 }
 
 /**
  * @brief Writes a keycode of the format `name` + "(" + `param` + ")".
- * @note `name` is a PROGMEM string, `param` is not.
+ * @note `name` is a PROGMEM string. `param` is formatted in `base`.
  */
-static void append_unary_keycode(const char* name, const char* param) {
-  append_P(name);
-  append_char('(');
-  append(param);
-  append_char(')');
+static void append_unary_keycode(writer_t* w, const char* name,
+                                 uint16_t param, int8_t base) {
+  append_P(w, name);
+  append_char(w, '(');
+  append_number(w, param, base);
+  append_char(w, ')');
 }
 
-/** Stringifies `keycode` and appends it to `buffer`. */
-static void append_keycode(uint16_t keycode) {
+/** Stringifies `keycode` and appends it. */
+static void append_keycode(writer_t* w, uint16_t keycode) {
   // In case there is overlap among tables, search `keycode_string_names_user`
   // first so that it takes precedence.
   const char* keycode_name = search_table(
       keycode_string_names_data_user, keycode_string_names_size_user, keycode);
   if (keycode_name) {
-    append(keycode_name);
+    append(w, keycode_name);
     return;
   }
-  keycode_name = search_common_names(keycode);
-  if (keycode_name) {
-    append(keycode_name);
+  if (append_common_name(w, keycode)) {
     return;
   }
 
@@ -294,38 +300,38 @@ static void append_keycode(uint16_t keycode) {
       case MODIFIER_KEYCODE_RANGE: {
         const uint8_t i = keycode - KC_LCTL;
         const bool is_rhs = i > 3;
-        append_P(PSTR("KC_"));
-        append_char(is_rhs ? 'R' : 'L');
-        append_P(&mod_names[4 * (i & 3)]);
+        append_P(w, PSTR("KC_"));
+        append_char(w, is_rhs ? 'R' : 'L');
+        append_P(w, &mod_names[4 * (i & 3)]);
       } return;
 
       // Letters A-Z.
       case KC_A ... KC_Z:
-        append_P(PSTR("KC_"));
-        append_char((char)(keycode + (UINT8_C('A') - KC_A)));
+        append_P(w, PSTR("KC_"));
+        append_char(w, (char)(keycode + (UINT8_C('A') - KC_A)));
         return;
 
       // Digits 0-9 (NOTE: Unlike the ASCII order, KC_0 comes *after* KC_9.)
       case KC_1 ... KC_0:
-        append_P(PSTR("KC_"));
-        append_char('0' + (char)((keycode - (KC_1 - 1)) % 10));
+        append_P(w, PSTR("KC_"));
+        append_char(w, '0' + (char)((keycode - (KC_1 - 1)) % 10));
         return;
 
       // Keypad digits.
       case KC_KP_1 ... KC_KP_0:
-        append_P(PSTR("KC_KP_"));
-        append_char('0' + (char)((keycode - (KC_KP_1 - 1)) % 10));
+        append_P(w, PSTR("KC_KP_"));
+        append_char(w, '0' + (char)((keycode - (KC_KP_1 - 1)) % 10));
         return;
 
       // Function keys. F1-F12 and F13-F24 are coded in separate ranges.
       case KC_F1 ... KC_F12:
-        append_P(PSTR("KC_F"));
-        append_number(keycode - (KC_F1 - 1), 10);
+        append_P(w, PSTR("KC_F"));
+        append_number(w, keycode - (KC_F1 - 1), 10);
         return;
 
       case KC_F13 ... KC_F24:
-        append_P(PSTR("KC_F"));
-        append_number(keycode - (KC_F13 - 13), 10);
+        append_P(w, PSTR("KC_F"));
+        append_number(w, keycode - (KC_F13 - 13), 10);
         return;
     }
   }
@@ -342,14 +348,14 @@ static void append_keycode(uint16_t keycode) {
       if (mods != 0 && (mods & (mods - 1)) == 0) {  // One mod is set.
         const char* name = &mod_names[4 * biton(mods)];
         if (is_rhs) {
-          append_char('R');
-          append_P(name);
+          append_char(w, 'R');
+          append_P(w, name);
         } else {
-          append_char(pgm_read_byte(&name[0]));
+          append_char(w, pgm_read_byte(&name[0]));
         }
-        append_char('(');
-        append_keycode(QK_MODS_GET_BASIC_KEYCODE(keycode));
-        append_char(')');
+        append_char(w, '(');
+        append_keycode(w, QK_MODS_GET_BASIC_KEYCODE(keycode));
+        append_char(w, ')');
         return;
       }
     } break;
@@ -357,65 +363,62 @@ static void append_keycode(uint16_t keycode) {
 #if !defined(NO_ACTION_ONESHOT)
     // One-shot mod OSM(mod) key.
     case QK_ONE_SHOT_MOD ... QK_ONE_SHOT_MOD_MAX:
-      append_P(PSTR("OSM("));
-      append_5_bit_mods(QK_ONE_SHOT_MOD_GET_MODS(keycode));
-      append_char(')');
+      append_P(w, PSTR("OSM("));
+      append_5_bit_mods(w, QK_ONE_SHOT_MOD_GET_MODS(keycode));
+      append_char(w, ')');
       return;
 #endif  // !defined(NO_ACTION_ONESHOT)
 
     // Various layer switch keys.
     case QK_LAYER_TAP ... QK_LAYER_TAP_MAX:  // Layer-tap LT(layer,kc) key.
-      append_P(PSTR("LT("));
-      append_number(QK_LAYER_TAP_GET_LAYER(keycode), 10);
-      append_char(',');
-      append_keycode(QK_LAYER_TAP_GET_TAP_KEYCODE(keycode));
-      append_char(')');
+      append_P(w, PSTR("LT("));
+      append_number(w, QK_LAYER_TAP_GET_LAYER(keycode), 10);
+      append_char(w, ',');
+      append_keycode(w, QK_LAYER_TAP_GET_TAP_KEYCODE(keycode));
+      append_char(w, ')');
       return;
 
     case QK_LAYER_MOD ... QK_LAYER_MOD_MAX:  // LM(layer,mod) key.
-      append_P(PSTR("LM("));
-      append_number(QK_LAYER_MOD_GET_LAYER(keycode), 10);
-      append_char(',');
-      append_5_bit_mods(QK_LAYER_MOD_GET_MODS(keycode));
-      append_char(')');
+      append_P(w, PSTR("LM("));
+      append_number(w, QK_LAYER_MOD_GET_LAYER(keycode), 10);
+      append_char(w, ',');
+      append_5_bit_mods(w, QK_LAYER_MOD_GET_MODS(keycode));
+      append_char(w, ')');
       return;
 
     case QK_TO ... QK_TO_MAX:  // TO(layer) key.
-      append_unary_keycode(PSTR("TO"),
-          number_string(QK_TO_GET_LAYER(keycode), 10));
+      append_unary_keycode(w, PSTR("TO"), QK_TO_GET_LAYER(keycode), 10);
       return;
 
     case QK_MOMENTARY ... QK_MOMENTARY_MAX:  // MO(layer) key.
-      append_unary_keycode(PSTR("MO"),
-          number_string(QK_MOMENTARY_GET_LAYER(keycode), 10));
+      append_unary_keycode(w, PSTR("MO"), QK_MOMENTARY_GET_LAYER(keycode), 10);
       return;
 
     case QK_DEF_LAYER ... QK_DEF_LAYER_MAX:  // DF(layer) key.
-      append_unary_keycode(PSTR("DF"),
-          number_string(QK_DEF_LAYER_GET_LAYER(keycode), 10));
+      append_unary_keycode(w, PSTR("DF"), QK_DEF_LAYER_GET_LAYER(keycode), 10);
       return;
 
     case QK_TOGGLE_LAYER ... QK_TOGGLE_LAYER_MAX:  // TG(layer) key.
-      append_unary_keycode(PSTR("TG"),
-          number_string(QK_TOGGLE_LAYER_GET_LAYER(keycode), 10));
+      append_unary_keycode(w, PSTR("TG"),
+          QK_TOGGLE_LAYER_GET_LAYER(keycode), 10);
       return;
 
 #if !defined(NO_ACTION_ONESHOT)
     case QK_ONE_SHOT_LAYER ... QK_ONE_SHOT_LAYER_MAX:  // OSL(layer) key.
-      append_unary_keycode(PSTR("OSL"),
-          number_string(QK_ONE_SHOT_LAYER_GET_LAYER(keycode), 10));
+      append_unary_keycode(w, PSTR("OSL"),
+          QK_ONE_SHOT_LAYER_GET_LAYER(keycode), 10);
       return;
 #endif  // !defined(NO_ACTION_ONESHOT)
 
     case QK_LAYER_TAP_TOGGLE ... QK_LAYER_TAP_TOGGLE_MAX:  // TT(layer) key.
-      append_unary_keycode(PSTR("TT"),
-          number_string(QK_LAYER_TAP_TOGGLE_GET_LAYER(keycode), 10));
+      append_unary_keycode(w, PSTR("TT"),
+          QK_LAYER_TAP_TOGGLE_GET_LAYER(keycode), 10);
       return;
 
     // PDF(layer) key.
     case QK_PERSISTENT_DEF_LAYER ... QK_PERSISTENT_DEF_LAYER_MAX:
-      append_unary_keycode(PSTR("PDF"),
-          number_string(QK_PERSISTENT_DEF_LAYER_GET_LAYER(keycode), 10));
+      append_unary_keycode(w, PSTR("PDF"),
+          QK_PERSISTENT_DEF_LAYER_GET_LAYER(keycode), 10);
       return;
 
     // Mod-tap MT(mod,kc) key. This implementation formats the MT keys where
@@ -426,83 +429,100 @@ static void append_keycode(uint16_t keycode) {
       const bool is_rhs = mods > 15;
       const uint8_t csag = mods & 15;
       if (csag != 0 && (csag & (csag - 1)) == 0) { // One mod is set.
-        append_char(is_rhs ? 'R' : 'L');
-        append_P(&mod_names[4 * biton(csag)]);
-        append_P(PSTR("_T("));
+        append_char(w, is_rhs ? 'R' : 'L');
+        append_P(w, &mod_names[4 * biton(csag)]);
+        append_P(w, PSTR("_T("));
       } else if (mods == MOD_HYPR) {
-        append_P(PSTR("HYPR_T("));
+        append_P(w, PSTR("HYPR_T("));
       } else if (mods == MOD_MEH) {
-        append_P(PSTR("MEH_T("));
+        append_P(w, PSTR("MEH_T("));
       } else {
-        append_P(PSTR("MT("));
-        append_number(mods, 16);
-        append_char(',');
+        append_P(w, PSTR("MT("));
+        append_number(w, mods, 16);
+        append_char(w, ',');
       }
-      append_keycode(QK_MOD_TAP_GET_TAP_KEYCODE(keycode));
-      append_char(')');
+      append_keycode(w, QK_MOD_TAP_GET_TAP_KEYCODE(keycode));
+      append_char(w, ')');
     } return;
 
     case QK_TAP_DANCE ... QK_TAP_DANCE_MAX:  // Tap dance TD(i) key.
-      append_unary_keycode(PSTR("TD"),
-          number_string(QK_TAP_DANCE_GET_INDEX(keycode), 10));
+      append_unary_keycode(w, PSTR("TD"), QK_TAP_DANCE_GET_INDEX(keycode), 10);
       return;
 
 #ifdef UNICODE_ENABLE
     case QK_UNICODE ... QK_UNICODE_MAX:  // Unicode UC(codepoint) key.
-      append_unary_keycode(PSTR("UC"),
-          number_string(QK_UNICODE_GET_CODE_POINT(keycode), 16));
+      append_unary_keycode(w, PSTR("UC"),
+          QK_UNICODE_GET_CODE_POINT(keycode), 16);
       return;
 #elif defined(UNICODEMAP_ENABLE)
     case QK_UNICODEMAP ... QK_UNICODEMAP_MAX:  // Unicode Map UM(i) key.
-      append_unary_keycode(PSTR("UM"),
-          number_string(QK_UNICODEMAP_GET_INDEX(keycode), 10));
+      append_unary_keycode(w, PSTR("UM"), QK_UNICODEMAP_GET_INDEX(keycode), 10);
       return;
 
     case QK_UNICODEMAP_PAIR ... QK_UNICODEMAP_PAIR_MAX: {  // UP(i,j) key.
       const uint8_t i = QK_UNICODEMAP_PAIR_GET_UNSHIFTED_INDEX(keycode);
       const uint8_t j = QK_UNICODEMAP_PAIR_GET_SHIFTED_INDEX(keycode);
-      append_P(PSTR("UP("));
-      append_number(i, 10);
-      append_char(',');
-      append_number(j, 10);
-      append_char(')');
+      append_P(w, PSTR("UP("));
+      append_number(w, i, 10);
+      append_char(w, ',');
+      append_number(w, j, 10);
+      append_char(w, ')');
     } return;
 #endif
 #ifdef MOUSEKEY_ENABLE
     case MS_BTN1 ... MS_BTN8:  // Mouse button keycode.
-      append_P(PSTR("MS_BTN"));
-      append_number(keycode - (MS_BTN1 - 1), 10);
+      append_P(w, PSTR("MS_BTN"));
+      append_number(w, keycode - (MS_BTN1 - 1), 10);
       return;
 #endif // MOUSEKEY_ENABLE
 #ifdef SWAP_HANDS_ENABLE
     case QK_SWAP_HANDS ... QK_SWAP_HANDS_MAX:  // Swap Hands SH_T(kc) key.
       if (!IS_SWAP_HANDS_KEYCODE(keycode)) {
-        append_P(PSTR("SH_T("));
-        append_keycode(QK_SWAP_HANDS_GET_TAP_KEYCODE(keycode));
-        append_char(')');
+        append_P(w, PSTR("SH_T("));
+        append_keycode(w, QK_SWAP_HANDS_GET_TAP_KEYCODE(keycode));
+        append_char(w, ')');
         return;
       }
       break;
 #endif // SWAP_HANDS_ENABLE
 
     case KB_KEYCODE_RANGE:  // Keyboard range keycode.
-      append_P(PSTR("QK_KB_"));
-      append_number(keycode - QK_KB_0, 10);
+      append_P(w, PSTR("QK_KB_"));
+      append_number(w, keycode - QK_KB_0, 10);
       return;
 
     case USER_KEYCODE_RANGE:  // User range keycode.
-      append_P(PSTR("QK_USER_"));
-      append_number(keycode - QK_USER_0, 10);
+      append_P(w, PSTR("QK_USER_"));
+      append_number(w, keycode - QK_USER_0, 10);
       return;
   }
   // clang-format on
 
-  append_number(keycode, 16); // Fallback: write keycode as hex value.
+  append_number(w, keycode, 16); // Fallback: write keycode as hex value.
+}
+
+uint8_t get_keycode_string_r(uint16_t keycode, char* dest, size_t size) {
+  if (size == 0) {
+    return 0;
+  }
+  writer_t w = {
+      .dest = dest,
+      .len = 0,
+      .max_len = (size - 1 < UINT8_MAX) ? size - 1 : UINT8_MAX,
+  };
+  dest[0] = '\0';
+  append_keycode(&w, keycode);
+  return w.len;
+}
+
+void get_keycode_strings_r(const uint16_t* keycodes, size_t count, char* dest,
+                           size_t stride) {
+  for (size_t i = 0; i < count; ++i) {
+    get_keycode_string_r(keycodes[i], dest + i * stride, stride);
+  }
 }
 
 const char* get_keycode_string(uint16_t keycode) {
-  buffer_len = 0;
-  buffer[0] = '\0';
-  append_keycode(keycode);
+  get_keycode_string_r(keycode, buffer, sizeof(buffer));
   return buffer;
 }
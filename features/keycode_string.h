@@ -37,6 +37,7 @@
 
 #pragma once
 
+#include <stddef.h>
 #include <stdint.h>
 
 #ifdef __cplusplus
@@ -52,6 +53,7 @@ extern "C" {
  *
  * @note The returned char* string should be used right away. The string memory
  * is reused and will be overwritten by the next call to `get_keycode_string()`.
+ * Use `get_keycode_string_r()` to format into a buffer of your own.
  *
  * Many common QMK keycodes are understood by this function, but not all.
  * Recognized keycodes include:
@@ -91,6 +93,41 @@ extern "C" {
  */
 const char* get_keycode_string(uint16_t keycode);
 
+/**
+ * @brief Reentrant form of `get_keycode_string()`.
+ *
+ * Formats `keycode` into the caller's buffer `dest` of `size` bytes, truncating
+ * if needed. The result is always null terminated if `size` > 0. Unlike
+ * `get_keycode_string()`, this function uses no static buffers, so several
+ * keycodes may be formatted in one printf, or in parallel threads:
+ *
+ *     char a[32];
+ *     char b[32];
+ *     get_keycode_string_r(kc_a, a, sizeof(a));
+ *     get_keycode_string_r(kc_b, b, sizeof(b));
+ *     xprintf("%s -> %s\n", a, b);
+ *
+ * @param keycode  QMK keycode.
+ * @param dest     Buffer to write to.
+ * @param size     Size of `dest` in bytes.
+ * @return         Length of the string written, excluding the null terminator.
+ */
+uint8_t get_keycode_string_r(uint16_t keycode, char* dest, size_t size);
+
+/**
+ * @brief Formats an array of keycodes in one call.
+ *
+ * Formats `keycodes[i]` into `dest + i * stride`, for i from 0 to `count - 1`,
+ * each as `get_keycode_string_r()` would with a buffer of `stride` bytes.
+ *
+ * @param keycodes  Array of `count` keycodes.
+ * @param count     Number of keycodes.
+ * @param dest      Buffer of at least `count * stride` bytes.
+ * @param stride    Bytes per string, including the null terminator.
+ */
+void get_keycode_strings_r(const uint16_t* keycodes, size_t count, char* dest,
+                           size_t stride);
+
 /** @deprecated Use `get_keycode_string()` instead. */
 static inline const char* keycode_string(uint16_t keycode) {
   return get_keycode_string(keycode);
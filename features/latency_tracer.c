@@ -0,0 +1,236 @@
+// Copyright 2026 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file latency_tracer.c
+ * @brief Latency Tracer implementation
+ */
+
+#include "latency_tracer.h"
+
+#ifdef LATENCY_TRACER_ENABLE
+
+#ifndef LATENCY_TRACER_REPORT_INTERVAL
+#define LATENCY_TRACER_REPORT_INTERVAL 10000
+#endif  // LATENCY_TRACER_REPORT_INTERVAL
+
+// Buckets are 0, 1, 2, 3, 4-7, 8-15, ..., 256-511, and 512+ ms.
+#define NUM_BUCKETS 12
+
+static const char* const path_names[LATENCY_TRACER_NUM_PATHS] = {
+    [LATENCY_PATH_PLAIN] = "plain",
+    [LATENCY_PATH_TAP] = "tap",
+    [LATENCY_PATH_CHORD] = "chord",
+    [LATENCY_PATH_HOLD] = "hold",
+    [LATENCY_PATH_TIMEOUT] = "timeout",
+};
+
+static struct {
+  uint32_t count;
+  uint32_t sum;
+  uint16_t max;
+  uint16_t histogram[NUM_BUCKETS];
+} stats[LATENCY_TRACER_NUM_PATHS];
+
+// State of the key event being processed.
+static struct {
+  uint8_t depth;
+  bool traced;
+  bool sent;
+  // Set when the event ended without a report, until the next event. A report
+  // sent meanwhile from a task, e.g. an Orbital Mouse click, is attributed to
+  // the event.
+  bool pending;
+  uint8_t path;
+  uint16_t event_time;
+  uint16_t latency;
+#ifndef LATENCY_TRACER_REPORT_HOOK
+  report_keyboard_t report;
+#ifdef MOUSEKEY_ENABLE
+  report_mouse_t mouse_report;
+#endif  // MOUSEKEY_ENABLE
+#endif  // LATENCY_TRACER_REPORT_HOOK
+} current = {0};
+
+static bool updated = false;
+static uint32_t report_timer = 0;
+
+static uint8_t bucket_index(uint16_t latency) {
+  if (latency < 4) {
+    return latency;
+  }
+  uint8_t i = 4;
+  for (uint16_t x = latency >> 3; x && i < NUM_BUCKETS - 1; x >>= 1) {
+    ++i;
+  }
+  return i;
+}
+
+static uint8_t decision_path(uint16_t keycode, keyrecord_t* record) {
+  if (!IS_QK_MOD_TAP(keycode) && !IS_QK_LAYER_TAP(keycode)) {
+    return LATENCY_PATH_PLAIN;
+  } else if (record->tap.count) {
+    return record->tap.interrupted ? LATENCY_PATH_CHORD : LATENCY_PATH_TAP;
+  } else {
+    return record->tap.interrupted ? LATENCY_PATH_HOLD : LATENCY_PATH_TIMEOUT;
+  }
+}
+
+#ifndef LATENCY_TRACER_REPORT_HOOK
+static void save_reports(void) {
+  memcpy(&current.report, keyboard_report, sizeof(report_keyboard_t));
+#ifdef MOUSEKEY_ENABLE
+  current.mouse_report = mousekey_get_report();
+#endif  // MOUSEKEY_ENABLE
+}
+
+/** Checks whether the keyboard or Mouse Keys report changed since saved. */
+static bool reports_changed(void) {
+  if (memcmp(&current.report, keyboard_report, sizeof(report_keyboard_t))) {
+    return true;
+  }
+#ifdef MOUSEKEY_ENABLE
+  const report_mouse_t mouse_report = mousekey_get_report();
+  if (memcmp(&current.mouse_report, &mouse_report, sizeof(report_mouse_t))) {
+    return true;
+  }
+#endif  // MOUSEKEY_ENABLE
+  return false;
+}
+#endif  // LATENCY_TRACER_REPORT_HOOK
+
+static void record_latency(void) {
+  const uint16_t latency = current.latency;
+  ++stats[current.path].count;
+  stats[current.path].sum += latency;
+  if (latency > stats[current.path].max) {
+    stats[current.path].max = latency;
+  }
+  uint16_t* bucket = &stats[current.path].histogram[bucket_index(latency)];
+  if (*bucket < UINT16_MAX) {
+    ++*bucket;
+  }
+  updated = true;
+}
+
+void latency_tracer_begin(uint16_t keycode, keyrecord_t* record) {
+  if (current.depth++) {
+    return;  // Nested event, e.g. from a handler calling process_record().
+  }
+  // Only presses are traced, since they are what the user waits on.
+  current.traced = record->event.pressed;
+  current.sent = false;
+  current.pending = false;
+  if (current.traced) {
+    current.path = decision_path(keycode, record);
+    current.event_time = record->event.time;
+#ifndef LATENCY_TRACER_REPORT_HOOK
+    save_reports();
+#endif  // LATENCY_TRACER_REPORT_HOOK
+  }
+}
+
+void latency_tracer_pre_process(uint16_t keycode, keyrecord_t* record) {
+  if (current.depth) {
+    // The previous event's end was skipped. Close it out, so that its latency
+    // is still measured and nesting starts over from this event.
+    current.depth = 1;
+    latency_tracer_end();
+  }
+  current.pending = false;
+
+  // Tap-hold keys are traced once decided, from latency_tracer_begin(). Other
+  // presses are traced from here, in case a handler that runs before
+  // process_record_user(), like a community module, handles the key.
+  if (record->event.pressed &&
+      decision_path(keycode, record) == LATENCY_PATH_PLAIN) {
+    current.traced = true;
+    current.sent = false;
+    current.pending = true;
+    current.path = LATENCY_PATH_PLAIN;
+    current.event_time = record->event.time;
+#ifndef LATENCY_TRACER_REPORT_HOOK
+    save_reports();
+#endif  // LATENCY_TRACER_REPORT_HOOK
+  }
+}
+
+void latency_tracer_report_sent(void) {
+  if (current.pending) {
+    current.pending = false;
+    current.sent = true;
+    current.latency = timer_elapsed(current.event_time);
+    record_latency();
+  } else if (current.depth && current.traced && !current.sent) {
+    current.sent = true;
+    current.latency = timer_elapsed(current.event_time);
+  }
+}
+
+void latency_tracer_end(void) {
+  if (!current.depth || --current.depth) {
+    return;
+  }
+#ifndef LATENCY_TRACER_REPORT_HOOK
+  if (current.traced && reports_changed()) {
+    latency_tracer_report_sent();
+  }
+#endif  // LATENCY_TRACER_REPORT_HOOK
+  if (current.sent) {
+    record_latency();
+  } else {
+    // No report yet, e.g. a layer switch, or a report to be sent by a task.
+    current.pending = current.traced;
+  }
+}
+
+void latency_tracer_report(void) {
+  uprintf("latency_tracer: ms from press to report\n");
+  uprintf("%-8s %6s %5s %5s |    0    1    2    3   4+   8+  16+  32+  64+ "
+          "128+ 256+ 512+\n",
+          "path", "count", "mean", "max");
+  for (uint8_t path = 0; path < LATENCY_TRACER_NUM_PATHS; ++path) {
+    const uint32_t count = stats[path].count;
+    if (!count) {
+      continue;
+    }
+    uprintf("%-8s %6lu %5lu %5u |", path_names[path], (unsigned long)count,
+            (unsigned long)(stats[path].sum / count), stats[path].max);
+    for (uint8_t i = 0; i < NUM_BUCKETS; ++i) {
+      uprintf(" %4u", stats[path].histogram[i]);
+    }
+    uprintf("\n");
+  }
+}
+
+void latency_tracer_reset(void) {
+  memset(stats, 0, sizeof(stats));
+  updated = false;
+}
+
+void latency_tracer_task(void) {
+#ifndef LATENCY_TRACER_REPORT_HOOK
+  if (current.pending && reports_changed()) {
+    latency_tracer_report_sent();
+  }
+#endif  // LATENCY_TRACER_REPORT_HOOK
+  if (updated &&
+      timer_elapsed32(report_timer) >= LATENCY_TRACER_REPORT_INTERVAL) {
+    latency_tracer_report();
+    updated = false;
+    report_timer = timer_read32();
+  }
+}
+
+#endif  // LATENCY_TRACER_ENABLE
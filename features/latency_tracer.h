@@ -0,0 +1,161 @@
+// Copyright 2026 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file latency_tracer.h
+ * @brief Latency Tracer - time from key press to HID report
+ *
+ * Overview
+ * --------
+ *
+ * Latency Tracer measures the time from when a key is pressed, as stamped in
+ * the key event, to when the resulting report is sent to the host. With
+ * tap-hold keys, most of this latency comes from waiting to decide between tap
+ * and hold, so latencies are kept in separate histograms by how the key was
+ * decided:
+ *
+ *  - "plain": not a tap-hold key.
+ *  - "tap": tap-hold key released within the tapping term.
+ *  - "chord": tap-hold key settled as tap while other keys were pressed, e.g.
+ *    a same-hand chord with Chordal Hold.
+ *  - "hold": tap-hold key settled as hold while other keys were pressed, e.g.
+ *    by Permissive Hold.
+ *  - "timeout": tap-hold key settled as hold when the tapping term expired.
+ *
+ *
+ * Add it to your keymap
+ * ---------------------
+ *
+ * In rules.mk, set `LATENCY_TRACER_ENABLE = yes` and `CONSOLE_ENABLE = yes`.
+ * Then in keymap.c, add
+ *
+ *     #include "features/latency_tracer.h"
+ *
+ *     bool pre_process_record_user(uint16_t keycode, keyrecord_t* record) {
+ *       latency_tracer_pre_process(keycode, record);
+ *       return true;
+ *     }
+ *
+ *     bool process_record_user(uint16_t keycode, keyrecord_t* record) {
+ *       latency_tracer_begin(keycode, record);
+ *       // Macros...
+ *       return true;
+ *     }
+ *
+ *     void post_process_record_user(uint16_t keycode, keyrecord_t* record) {
+ *       latency_tracer_end();
+ *     }
+ *
+ *     void housekeeping_task_user(void) {
+ *       latency_tracer_task();
+ *       // Other tasks...
+ *     }
+ *
+ * QMK skips post_process_record_user() when a handler returns false, as on an
+ * autocorrection or a Magic keycode. latency_tracer_pre_process() closes out
+ * such an event when the next one arrives, so it must be called too. It also
+ * starts tracing presses of keys other than tap-hold keys, so that those
+ * handled by community modules, which run before process_record_user(), are
+ * measured.
+ *
+ * Histograms are printed to the console every `LATENCY_TRACER_REPORT_INTERVAL`
+ * ms while there are new measurements, or on request by calling
+ * `latency_tracer_report()`, e.g. from a custom keycode:
+ *
+ *     case LATDUMP:
+ *       if (record->event.pressed) {
+ *         latency_tracer_report();
+ *       }
+ *       return false;
+ *
+ * Between begin and end, the tracer compares the keyboard report, and with
+ * Mouse Keys the mouse report, to detect whether a report was sent. If neither
+ * changed, the press stays pending until the next key event, and a report sent
+ * meanwhile from a task, e.g. a deferred macro, is attributed to it. Where
+ * report sending can be hooked directly, as in the host simulator, instead
+ * define `LATENCY_TRACER_REPORT_HOOK` and call `latency_tracer_report_sent()`
+ * from the keyboard and mouse report senders. Otherwise, code that sends mouse
+ * reports with host_mouse_send() from a task, such as Orbital Mouse, is only
+ * seen if it calls `latency_tracer_report_sent()` after sending.
+ *
+ * @note Tap-hold keys are traced from process_record_user(), once decided, so
+ * a tap-hold key handled by a community module is not measured.
+ */
+
+#pragma once
+
+#include "quantum.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** How a key press was decided. */
+enum latency_tracer_paths {
+  LATENCY_PATH_PLAIN,
+  LATENCY_PATH_TAP,
+  LATENCY_PATH_CHORD,
+  LATENCY_PATH_HOLD,
+  LATENCY_PATH_TIMEOUT,
+  LATENCY_TRACER_NUM_PATHS,
+};
+
+#ifdef LATENCY_TRACER_ENABLE
+
+/** Marks the start of processing a key event. */
+void latency_tracer_begin(uint16_t keycode, keyrecord_t* record);
+
+/** Marks the end of processing the key event. */
+void latency_tracer_end(void);
+
+/**
+ * Marks the arrival of a new key event, before tap-hold handling. Closes out
+ * the previous event if its end was skipped. Call from
+ * pre_process_record_user().
+ */
+void latency_tracer_pre_process(uint16_t keycode, keyrecord_t* record);
+
+/**
+ * Called by the keyboard and mouse report senders when
+ * `LATENCY_TRACER_REPORT_HOOK` is defined, or after any host_mouse_send() call
+ * that the tracer otherwise wouldn't see.
+ */
+void latency_tracer_report_sent(void);
+
+/** Periodically prints histograms. Call from housekeeping_task_user(). */
+void latency_tracer_task(void);
+
+/** Prints the latency histogram of each decision path. */
+void latency_tracer_report(void);
+
+/** Clears all measurements. */
+void latency_tracer_reset(void);
+
+#else
+
+static inline void latency_tracer_begin(uint16_t keycode,
+                                        keyrecord_t* record) {}
+static inline void latency_tracer_end(void) {}
+static inline void latency_tracer_pre_process(uint16_t keycode,
+                                              keyrecord_t* record) {}
+static inline void latency_tracer_report_sent(void) {}
+static inline void latency_tracer_task(void) {}
+static inline void latency_tracer_report(void) {}
+static inline void latency_tracer_reset(void) {}
+
+#endif  // LATENCY_TRACER_ENABLE
+
+#ifdef __cplusplus
+}
+#endif
@@ -22,6 +22,8 @@
 
 #include "layer_lock.h"
 
+#include "deadlines.h"
+
 #pragma message \
     "Layer Lock is now a core QMK feature! To use it, update your QMK set up and see https://docs.qmk.fm/features/layer_lock"
 
@@ -34,10 +36,15 @@ static layer_state_t locked_layers = 0;
 static uint32_t layer_lock_timer = 0;
 
 void layer_lock_task(void) {
-  if (locked_layers &&
-      timer_elapsed32(layer_lock_timer) > LAYER_LOCK_IDLE_TIMEOUT) {
-    layer_lock_all_off();
-    layer_lock_timer = timer_read32();
+  if (locked_layers) {
+    const uint32_t elapsed = timer_elapsed32(layer_lock_timer);
+    if (elapsed > LAYER_LOCK_IDLE_TIMEOUT) {
+      layer_lock_all_off();
+      layer_lock_timer = timer_read32();
+    } else {
+      // Timeouts longer than a deadline's reach take more than one wake up.
+      deadline_set_in(layer_lock_task, LAYER_LOCK_IDLE_TIMEOUT + 1 - elapsed);
+    }
   }
 }
 #endif  // LAYER_LOCK_IDLE_TIMEOUT > 0
@@ -57,6 +64,9 @@ bool process_layer_lock(uint16_t keycode, keyrecord_t* record,
                         uint16_t lock_keycode) {
 #if LAYER_LOCK_IDLE_TIMEOUT > 0
   layer_lock_timer = timer_read32();
+  if (locked_layers) {
+    deadline_set_in(layer_lock_task, LAYER_LOCK_IDLE_TIMEOUT + 1);
+  }
 #endif  // LAYER_LOCK_IDLE_TIMEOUT > 0
 
   // The intention is that locked layers remain on. If something outside of
@@ -121,6 +131,7 @@ void layer_lock_invert(uint8_t layer) {
     layer_on(layer);
 #if LAYER_LOCK_IDLE_TIMEOUT > 0
     layer_lock_timer = timer_read32();
+    deadline_set_in(layer_lock_task, LAYER_LOCK_IDLE_TIMEOUT + 1);
 #endif  // LAYER_LOCK_IDLE_TIMEOUT > 0
   } else {  // Layer is being unlocked.
     layer_off(layer);
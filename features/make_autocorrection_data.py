@@ -15,8 +15,8 @@
 """Python program to make autocorrection_data.h.
 
 This program reads "autocorrection_dict.txt" from the current directory and
-generates a C source file "autocorrection_data.h" with a serialized trie
-embedded as an array. Run this program without arguments like
+generates a C source file "autocorrection_data.h" with a serialized Aho-Corasick
+automaton embedded as an array. Run this program without arguments like
 
 $ python3 make_autocorrection_data.py
 
@@ -29,6 +29,23 @@ dictionary. Or optionally specify the output .h file as well like
 
 $ python3 make_autocorrection_data.py dict.txt somewhere/out.h
 
+To check that typos don't falsely trigger on correctly spelled words, the
+typos are checked against the english_words package, if installed, and any
+word lists given with `--words`, a file with one word per line:
+
+$ python3 make_autocorrection_data.py --words /usr/share/dict/words dict.txt
+
+The script prints the size of the table, and the entries that cost the most
+bytes of it. Run with `--costs` to print the cost of every entry.
+
+By default, each state of the automaton lists its transitions as (symbol, link)
+pairs, which the C code scans. With the `--bitmap` flag, larger rows are
+instead indexed by a bitmap of symbols, which is faster and smaller for large
+dictionaries. The generated .h file defines AUTOCORRECTION_BITMAP_ROWS in that
+case, so that autocorrection.c reads the matching format. Likewise, the script
+uses failure links in place of complete transitions where that is smaller, or
+if `--fail-links` is given, and 3-byte links if the table exceeds 64KB.
+
 Each line of the dict file defines one typo and its correction with the syntax
 "typo -> correction". Blank lines or lines starting with '#' are ignored.
 Example:
@@ -46,10 +63,13 @@ For full documentation, see
 https://getreuer.info/posts/keyboards/autocorrection
 """
 
+import argparse
+import itertools
+import multiprocessing
+import os
 import os.path
 import sys
-import textwrap
-from typing import Any, Dict, Iterator, List, Tuple
+from typing import Any, Dict, Iterable, Iterator, List, Tuple
 
 try:
   from english_words import english_words_lower_alpha_set as CORRECT_WORDS
@@ -68,6 +88,18 @@ KC_A = 4
 KC_SPC = 0x2c
 KC_QUOT = 0x34
 
+# Symbols of the automaton, in the order that the C code numbers them.
+SYMBOLS = "abcdefghijklmnopqrstuvwxyz':"
+SYMBOL_INDEX = {c: i for i, c in enumerate(SYMBOLS)}
+WORD_BREAK = SYMBOL_INDEX[':']
+
+# Number of entries whose cost is printed by default.
+NUM_COSTLIEST = 10
+
+# Beyond this many states, DFA rows are not tried, since they are slow to make
+# and much larger than rows with failure links.
+MAX_DFA_STATES = 50000
+
 TYPO_CHARS = dict(
   [
     ("'", KC_QUOT),
@@ -83,9 +115,10 @@ def parse_file(file_name: str) -> List[Tuple[str, str]]:
 
   Each line of the file defines one typo and its correction with the syntax
   "typo -> correction". Blank lines or lines starting with '#' are ignored. The
-  function validates that typos only have characters in TYPO_CHARS, that
-  typos are not substrings of other typos, and checking that typos don't trigger
-  on CORRECT_WORDS.
+  function validates that typos only have characters in TYPO_CHARS. The other
+  checks, that typos are not substrings of one another and don't trigger on
+  correct words, are done on the automaton by check_substrings() and
+  check_words().
 
   Args:
     file_name: String, path of the autocorrections dictionary.
@@ -101,44 +134,154 @@ def parse_file(file_name: str) -> List[Tuple[str, str]]:
       continue
 
     # Check that `typo` is valid.
-    if not(all([c in TYPO_CHARS for c in typo])):
+    if not TYPO_CHARS.keys() >= set(typo):
       print(f'Error:{line_number}: Typo "{typo}" has '
             'characters other than ' + ''.join(TYPO_CHARS.keys()))
       sys.exit(1)
-    for other_typo in typos:
-      if typo in other_typo or other_typo in typo:
-        print(f'Error:{line_number}: Typos may not be substrings of one '
-              f'another, otherwise the longer typo would never trigger: '
-              f'"{typo}" vs. "{other_typo}".')
-        sys.exit(1)
     if len(typo) < 5:
       print(f'Warning:{line_number}: It is suggested that typos are at '
             f'least 5 characters long to avoid false triggers: "{typo}"')
 
-    check_typo_against_dictionary(line_number, typo)
-
     autocorrections.append((typo, correction))
     typos.add(typo)
 
+  if not autocorrections:
+    print(f'Error: No autocorrection entries in "{file_name}".')
+    sys.exit(1)
   return autocorrections
 
 
-def make_trie(autocorrections: List[Tuple[str, str]]) -> Dict[str, Any]:
-  """Makes a trie from the the typos, writing in reverse.
+def make_automaton(autocorrections: List[Tuple[str, str]]) -> Dict[str, Any]:
+  """Makes an Aho-Corasick automaton from the typos.
+
+  The typos are arranged in a trie with failure links, where the failure link
+  of a state goes to the state for the longest proper suffix of its string.
+  Provided that typos are not substrings of one another, which
+  check_substrings() verifies, a typo is matched exactly when its leaf state is
+  reached.
 
   Args:
     autocorrections: List of (typo, correction) tuples.
   Returns:
-    Dict of dict, representing the trie.
+    Dict with 'leaf', a list of (typo, correction) or None per state,
+    'children', a dict per state mapping the index in SYMBOLS of a symbol to a
+    child state, 'parent', the parent of each state in the trie, 'last', the
+    index in SYMBOLS of the last symbol of each state's string, and 'fail', the
+    failure link of each state. States are numbered in breadth-first order,
+    with the root as state 0.
   """
-  trie = {}
-  for typo, correction in autocorrections:
-    node = trie
-    for letter in typo[::-1]:
-      node = node.setdefault(letter, {})
-    node['LEAF'] = (typo, correction)
+  # Build the trie, with `children[s]` mapping a symbol index to a child.
+  # Typos are inserted in order of their symbol indices, so that children are
+  # too.
+  to_symbols = str.maketrans(SYMBOLS, ''.join(map(chr, range(len(SYMBOLS)))))
+  keyed = sorted((typo.translate(to_symbols).encode(), (typo, correction))
+                 for typo, correction in autocorrections)
+  children = [{}]
+  leaf = [None]
+  for key, entry in keyed:
+    state = 0
+    for symbol in key:
+      child = children[state].get(symbol)
+      if child is None:
+        child = children[state][symbol] = len(children)
+        children.append({})
+        leaf.append(None)
+      state = child
+    leaf[state] = entry
+
+  # Number states in breadth-first order.
+  order = [0]
+  for state in order:
+    order.extend(children[state].values())
+  new_index = [0] * len(order)
+  for i, state in enumerate(order):
+    new_index[state] = i
+  children = [{symbol: new_index[child]
+               for symbol, child in children[state].items()}
+              for state in order]
+  leaf = [leaf[state] for state in order]
+
+  # Compute failure links in breadth-first order.
+  num_states = len(order)
+  parent = [0] * num_states
+  last = [None] * num_states
+  fail = [0] * num_states
+  for state in range(num_states):
+    for symbol, child in children[state].items():
+      parent[child] = state
+      last[child] = symbol
+      if state:
+        f = fail[state]
+        while f and symbol not in children[f]:
+          f = fail[f]
+        fail[child] = children[f].get(symbol, 0)
+
+  return {
+    'leaf': leaf,
+    'children': children,
+    'parent': parent,
+    'last': last,
+    'fail': fail,
+  }
+
+
+def complete_transitions(automaton: Dict[str, Any]) -> List[List[int]]:
+  """Completes the automaton into a DFA.
 
-  return trie
+  Returns:
+    List of the transitions from each state for each of SYMBOLS, where a
+    missing transition from a state goes where the transition from its
+    failure state goes.
+  """
+  children = automaton['children']
+  fail = automaton['fail']
+  delta = [None] * len(children)
+  delta[0] = [children[0].get(symbol, 0) for symbol in range(len(SYMBOLS))]
+  for state in range(1, len(children)):
+    delta[state] = delta[fail[state]][:]
+    for symbol, child in children[state].items():
+      delta[state][symbol] = child
+  return delta
+
+
+def check_substrings(automaton: Dict[str, Any]) -> None:
+  """Checks that typos are not substrings of one another.
+
+  Otherwise, the longer typo would never trigger. A typo is a substring of
+  another when its leaf has children, or when it is a suffix of the string of
+  some state, that is, its leaf is on the chain of failure links from that
+  state. So the check takes one pass over the states.
+  """
+  leaf = automaton['leaf']
+  parent = automaton['parent']
+  fail = automaton['fail']
+  # For each state, the nearest leaf on its failure chain, excluding itself.
+  suffix_leaf = [0] * len(leaf)
+  conflicts = []
+  for state in range(1, len(leaf)):
+    f = fail[state]
+    suffix_leaf[state] = f if leaf[f] else suffix_leaf[f]
+    if suffix_leaf[state]:
+      conflicts.append((suffix_leaf[state], state))
+    if leaf[parent[state]]:
+      conflicts.append((parent[state], state))
+
+  if conflicts:
+    # A typo through a state is found by following the first child downward.
+    first_child = {}
+    for state in range(len(leaf) - 1, 0, -1):
+      first_child[parent[state]] = state
+    reported = set()
+    for short, state in conflicts:
+      while not leaf[state]:
+        state = first_child[state]
+      pair = (leaf[short][0], leaf[state][0])
+      if pair not in reported:
+        reported.add(pair)
+        print(f'Error: Typos may not be substrings of one another, otherwise '
+              f'the longer typo would never trigger: "{pair[0]}" vs. '
+              f'"{pair[1]}".')
+    sys.exit(1)
 
 
 def parse_file_lines(file_name: str) -> Iterator[Tuple[int, str, str]]:
@@ -162,46 +305,148 @@ def parse_file_lines(file_name: str) -> Iterator[Tuple[int, str, str]]:
       yield line_number, typo, correction
 
 
-def check_typo_against_dictionary(line_number: int, typo: str) -> None:
-  """Checks `typo` against English dictionary words."""
-
-  if typo.startswith(':') and typo.endswith(':'):
-    if typo[1:-1] in CORRECT_WORDS:
-      print(f'Warning:{line_number}: Typo "{typo}" is a correctly spelled '
-            'dictionary word.')
-  elif typo.startswith(':') and not typo.endswith(':'):
-    for word in CORRECT_WORDS:
-      if word.startswith(typo[1:]):
-        print(f'Warning:{line_number}: Typo "{typo}" would falsely trigger '
-              f'on correctly spelled word "{word}".')
-  elif not typo.startswith(':') and typo.endswith(':'):
-    for word in CORRECT_WORDS:
-      if word.endswith(typo[:-1]):
-        print(f'Warning:{line_number}: Typo "{typo}" would falsely trigger '
-              f'on correctly spelled word "{word}".')
-  elif not typo.startswith(':') and not typo.endswith(':'):
-    for word in CORRECT_WORDS:
-      if typo in word:
-        print(f'Warning:{line_number}: Typo "{typo}" would falsely trigger '
-              f'on correctly spelled word "{word}".')
-
-
-def serialize_trie(autocorrections: List[Tuple[str, str]],
-                   trie: Dict[str, Any]) -> List[int]:
-  """Serializes trie and correction data in a form readable by the C code.
+# The automaton, shared with worker processes by check_words().
+_scan_automaton = None
+
+
+def scan_words(words: List[str]) -> List[Tuple[str, str]]:
+  """Finds the typos of `_scan_automaton` that trigger within `words`."""
+  children = _scan_automaton['children']
+  fail = _scan_automaton['fail']
+  leaf = _scan_automaton['leaf']
+  hits = []
+  for word in words:
+    # Type the word between word breaks, as the keyboard would see it.
+    state = 0
+    for c in f':{word}:':
+      symbol = SYMBOL_INDEX.get(c, WORD_BREAK)
+      while state and symbol not in children[state]:
+        state = fail[state]
+      state = children[state].get(symbol, 0)
+      if leaf[state]:
+        hits.append((word, leaf[state][0]))
+  return hits
+
+
+def check_words(automaton: Dict[str, Any], words: Iterable[str]) -> None:
+  """Checks that typos don't trigger on correctly spelled words.
+
+  Each word is run through the automaton, so that all typos are checked in one
+  pass over the word list. The pass is split across processes for large lists.
+  """
+  global _scan_automaton
+  words = sorted(words)
+  _scan_automaton = automaton
+  num_jobs = min(os.cpu_count() or 1, len(words) // 20000)
+  if (num_jobs > 1 and
+      'fork' in multiprocessing.get_all_start_methods()):
+    # Forked workers inherit `_scan_automaton` without copying it.
+    with multiprocessing.get_context('fork').Pool(num_jobs) as pool:
+      hits = pool.map(scan_words, [words[i::num_jobs]
+                                   for i in range(num_jobs)])
+    hits = [hit for job_hits in hits for hit in job_hits]
+  else:
+    hits = scan_words(words)
+  _scan_automaton = None
+
+  for word, typo in sorted(hits, key=lambda hit: (hit[1], hit[0])):
+    if typo == f':{word}:':
+      print(f'Warning: Typo "{typo}" is a correctly spelled dictionary word.')
+    else:
+      print(f'Warning: Typo "{typo}" would falsely trigger on correctly '
+            f'spelled word "{word}".')
+
+
+def read_words(file_name: str) -> Iterator[str]:
+  """Reads a word list with one word per line."""
+  with open(file_name, 'rt', errors='replace') as f:
+    for line in f:
+      word = line.strip().lower()
+      if word:
+        yield word
+
+
+def serialize_automaton(automaton: Dict[str, Any],
+                        bitmap_rows: bool,
+                        fail_links: bool) -> Dict[str, Any]:
+  """Serializes the automaton in a form readable by the C code.
+
+  The table begins with the root's transition for each symbol, as links. Each
+  following state is either a leaf, serialized as
+
+    128 + backspaces, correction string, 0
+
+  or, if the correction string is a suffix of another leaf's string, as a link
+  to where it starts within that string,
+
+    128 + 64 + backspaces, link
+
+  so that corrections sharing an ending, like "return" for "retrun" and
+  "retun", are stored once. Otherwise, a state is a row listing n transitions, ordered by symbol, with a fallback for other
+  symbols. By default, the automaton is completed into a DFA, and a row lists
+  the transitions that differ from the state's defaults. For a state whose
+  string ends in symbol s, most transitions are the same as from the state for
+  s alone, so where that state exists and is another state, those are the
+  defaults and the row is
+
+    64 + n, s, (symbol, link) x n
+
+  Otherwise, the defaults are the root's transitions and the row is
+
+    n, (symbol, link) x n
+
+  Whatever the state, the C code then makes a transition by scanning at most
+  two rows and reading one root link.
+
+  DFA rows grow dense for large dictionaries. With `fail_links`, a row instead
+  lists only the state's children in the trie, followed by its failure link
+  unless that is the root, as
+
+    64 + n, failure link, (symbol, link) x n
+
+  The C code follows failure links until a row has the symbol. Since each key
+  deepens the state by at most one, this takes fewer than two row scans per key
+  on average, and at most AUTOCORRECTION_MAX_LENGTH.
+
+  A link is the byte offset of the target state, with the root at offset 0.
+  Links are 2 bytes, little endian, or 3 bytes if the table exceeds 64KB.
+
+  With `bitmap_rows`, a row of more than 4 transitions is instead serialized
+  with a 28-bit bitmap of its symbols, followed by the links alone, as
+
+    32 + n, [s or failure link,] bitmap (4 bytes, little endian), link x n
+
+  The C code finds the link for a symbol directly by counting the bits set below
+  it in the bitmap.
 
   Args:
-    autocorrections: List of (typo, correction) tuples.
-    trie: Dict of dicts.
+    automaton: Dict from make_automaton().
+    bitmap_rows: Bool, whether to use bitmap rows.
+    fail_links: Bool, whether to use failure links instead of DFA rows.
   Returns:
-    List of ints in the range 0-255.
+    Dict with 'data', the serialized bytes, 'link_size', the
+    number of bytes per link, and 'state_sizes', the bytes of each state.
   """
-  table = []
-
-  # Traverse trie in depth first order.
-  def traverse(trie_node: Dict[str, Any]) -> Dict[str, Any]:
-    if 'LEAF' in trie_node:  # Handle a leaf trie node.
-      typo, correction = trie_node['LEAF']
+  leaf = automaton['leaf']
+  children = automaton['children']
+  last = automaton['last']
+  fail = automaton['fail']
+  if fail_links:
+    root_delta = [children[0].get(symbol, 0) for symbol in range(len(SYMBOLS))]
+  else:
+    delta = complete_transitions(automaton)
+    root_delta = delta[0]
+
+  # Each state is first reduced to a tuple (head, fallback, mid, targets),
+  # serialized as the bytes `head`, the link to state `fallback` if nonzero,
+  # the bytes `mid`, and the links to `targets`. In a list row, `mid` holds the
+  # symbols, each of which precedes its link. This way the size of each state
+  # is known before the offsets are.
+  states = [None]
+  corrections = {}
+  for state in range(1, len(leaf)):
+    if leaf[state]:
+      typo, correction = leaf[state]
       word_boundary_ending = typo[-1] == ':'
       typo = typo.strip(':')
       i = 0  # Make the autocorrection data for this entry and serialize it.
@@ -209,71 +454,147 @@ def serialize_trie(autocorrections: List[Tuple[str, str]],
         i += 1
       backspaces = len(typo) - i - 1 + word_boundary_ending
       assert 0 <= backspaces <= 63
-      correction = correction[i:]
-      data = [backspaces + 128] + list(bytes(correction, 'ascii')) + [0]
-
-      entry = {'data': data, 'links': [], 'byte_offset': 0}
-      table.append(entry)
-    elif len(trie_node) == 1:  # Handle trie node with a single child.
-      c, trie_node = next(iter(trie_node.items()))
-      entry = {'chars': c, 'byte_offset': 0}
-
-      # It's common for a trie to have long chains of single-child nodes. We
-      # find the whole chain so that we can serialize it more efficiently.
-      while len(trie_node) == 1 and 'LEAF' not in trie_node:
-        c, trie_node = next(iter(trie_node.items()))
-        entry['chars'] += c
-
-      table.append(entry)
-      entry['links'] = [traverse(trie_node)]
-    else:  # Handle trie node with multiple children.
-      entry = {'chars': ''.join(sorted(trie_node.keys())), 'byte_offset': 0}
-      table.append(entry)
-      entry['links'] = [traverse(trie_node[c]) for c in entry['chars']]
-    return entry
-
-  traverse(trie)
-
-  def serialize(e: Dict[str, Any]) -> List[int]:
-    if not e['links']:  # Handle a leaf table entry.
-      return e['data']
-    elif len(e['links']) == 1:  # Handle a chain table entry.
-      return [TYPO_CHARS[c] for c in e['chars']] + [0]
-    else:  # Handle a branch table entry.
-      data = []
-      for c, link in zip(e['chars'], e['links']):
-        data += [TYPO_CHARS[c] | (0 if data else 64)] + encode_link(link)
-      return data + [0]
-
-  byte_offset = 0
-  for e in table:  # To encode links, first compute byte offset of each entry.
-    e['byte_offset'] = byte_offset
-    byte_offset += len(serialize(e))
-
-  return [b for e in table for b in serialize(e)]  # Serialize final table.
-
-
-def encode_link(link: Dict[str, Any]) -> List[int]:
-  """Encodes a node link as two bytes."""
-  byte_offset = link['byte_offset']
-  if not (0 <= byte_offset <= 0xffff):
+      corrections[state] = bytes(correction[i:], 'ascii')
+      states.append((bytes([backspaces + 128]), 0, b'', ()))
+      continue
+
+    if fail_links:
+      head = [64] if fail[state] else [0]
+      fallback = fail[state]
+      symbols = list(children[state])
+      targets = list(children[state].values())
+    else:
+      fallback = 0
+      short_state = root_delta[last[state]]  # State for the last symbol alone.
+      if short_state in (0, state):
+        defaults = root_delta
+        head = [0]
+      else:
+        defaults = delta[short_state]
+        head = [64, last[state]]
+      symbols = [symbol for symbol, target in enumerate(delta[state])
+                 if target != defaults[symbol]]
+      targets = [delta[state][symbol] for symbol in symbols]
+    head[0] += len(symbols)
+    if bitmap_rows and len(symbols) > 4:  # Bitmap row, if smaller.
+      head[0] += 32
+      mid = sum(1 << symbol for symbol in symbols).to_bytes(4, 'little')
+    else:
+      mid = bytes(symbols)
+    states.append((bytes(head), fallback, mid, targets))
+
+  # Tail-merge the correction strings, longest first. A string is stored in its
+  # leaf unless it is a suffix of a string already stored, and is short enough
+  # that a link would be no smaller. `string_refs` maps a leaf to the leaf
+  # whose string it ends and the position in that string.
+  string_refs = {}
+  stored = {}
+  for state, correction in sorted(corrections.items(),
+                                  key=lambda item: (-len(item[1]), item[0])):
+    if correction in stored and len(correction) > 2:
+      string_refs[state] = stored[correction]
+      head = states[state][0]
+      states[state] = (bytes([head[0] + 64]), 0, b'', ())
+    else:
+      for i in range(len(correction)):
+        stored.setdefault(correction[i:], (state, i))
+      states[state] = (states[state][0] + correction + b'\0', 0, b'', ())
+
+  # To encode links, first compute the byte offset of each state. Links have
+  # fixed size, so the size of a state doesn't depend on the offsets.
+  num_bytes = [0] + [len(head) + len(mid)
+                     for head, _, mid, _ in states[1:]]
+  num_links = [len(SYMBOLS)] + [len(targets) + (1 if fallback else 0)
+                                for _, fallback, _, targets in states[1:]]
+  for state in string_refs:
+    num_links[state] = 1
+  for link_size in (2, 3):
+    state_sizes = [b + link_size * n for b, n in zip(num_bytes, num_links)]
+    if sum(state_sizes) <= 0x10000 or link_size == 3:
+      break
+  offsets = list(itertools.accumulate(state_sizes, initial=0))
+  byte_offset = offsets.pop()
+  encode_offset(byte_offset - 1, link_size)  # Check that links fit.
+  links = [offset.to_bytes(link_size, 'little') for offset in offsets]
+
+  data = bytearray()
+  for target in root_delta:
+    data += links[target]
+  for state in range(1, len(leaf)):
+    head, fallback, mid, targets = states[state]
+    data += head
+    if state in string_refs:
+      # Link to the string of another leaf, just after its first byte.
+      other, i = string_refs[state]
+      data += (offsets[other] + 1 + i).to_bytes(link_size, 'little')
+    if fallback:
+      data += links[fallback]
+    if len(mid) == len(targets):  # List row.
+      for symbol, target in zip(mid, targets):
+        data.append(symbol)
+        data += links[target]
+    else:
+      data += mid
+      for target in targets:
+        data += links[target]
+  assert len(data) == byte_offset
+  return {
+    'data': data,
+    'link_size': link_size,
+    'state_sizes': state_sizes,
+  }
+
+
+def encode_offset(byte_offset: int, link_size: int) -> bytes:
+  """Encodes a state link as `link_size` bytes, little endian."""
+  if not (0 <= byte_offset < 1 << (8 * link_size)):
     print('Error: The autocorrection table is too large, a node link exceeds '
-          '64KB limit. Try reducing the autocorrection dict to fewer entries.')
+          '16MB limit. Try reducing the autocorrection dict to fewer entries.')
     sys.exit(1)
-  return [byte_offset & 255, byte_offset >> 8]
+  return byte_offset.to_bytes(link_size, 'little')
+
+
+def entry_costs(automaton: Dict[str, Any],
+                state_sizes: List[int]) -> List[Tuple[float, str, str]]:
+  """Computes how many bytes of the table each entry costs.
+
+  The bytes of each state are divided evenly among the entries whose typos pass
+  through it. So entries sharing a prefix share its cost, and the costs sum to
+  the table size, except for the root's links.
+
+  Returns:
+    List of (bytes, typo, correction) tuples, costliest first.
+  """
+  leaf = automaton['leaf']
+  parent = automaton['parent']
+  num_leaves = [1 if entry else 0 for entry in leaf]
+  for state in range(len(leaf) - 1, 0, -1):
+    num_leaves[parent[state]] += num_leaves[state]
+  cost = [0.0] * len(leaf)
+  for state in range(1, len(leaf)):
+    cost[state] = cost[parent[state]] + state_sizes[state] / num_leaves[state]
+  return sorted(((cost[state], *entry) for state, entry in enumerate(leaf)
+                 if entry), key=lambda c: (-c[0], c[1]))
 
 
 def write_generated_code(autocorrections: List[Tuple[str, str]],
-                         data: List[int],
+                         num_states: int,
+                         bitmap_rows: bool,
+                         fail_links: bool,
+                         link_size: int,
+                         data: bytes,
                          file_name: str) -> None:
   """Writes autocorrection data as generated C code to `file_name`.
 
   Args:
     autocorrections: List of (typo, correction) tuples.
-    data: List of ints in 0-255, the serialized trie.
+    num_states: Int, number of states in the automaton.
+    bitmap_rows: Bool, whether the data uses bitmap rows.
+    fail_links: Bool, whether the data uses failure links.
+    link_size: Int, number of bytes per link.
+    data: Bytes of the serialized automaton.
     file_name: String, path of the output C file.
   """
-  assert all(0 <= b <= 255 for b in data)
 
   def typo_len(e: Tuple[str, str]) -> int:
     return len(e[0])
@@ -286,29 +607,87 @@ def write_generated_code(autocorrections: List[Tuple[str, str]],
     ''.join(sorted(f'//   {typo:<{len(max_typo)}} -> {correction}\n'
                    for typo, correction in autocorrections)),
     f'\n#define AUTOCORRECTION_MIN_LENGTH {len(min_typo)}  // "{min_typo}"\n',
-    f'#define AUTOCORRECTION_MAX_LENGTH {len(max_typo)}  // "{max_typo}"\n\n',
-    textwrap.fill('static const uint8_t autocorrection_data[%d] PROGMEM = {%s};' % (
-      len(data), ', '.join(map(str, data))), width=80, subsequent_indent='  '),
+    f'#define AUTOCORRECTION_MAX_LENGTH {len(max_typo)}  // "{max_typo}"\n',
+    f'#define AUTOCORRECTION_NUM_STATES {num_states}\n',
+    '#define AUTOCORRECTION_BITMAP_ROWS\n' if bitmap_rows else '',
+    '#define AUTOCORRECTION_FAIL_LINKS\n' if fail_links else '',
+    f'#define AUTOCORRECTION_LINK_SIZE {link_size}\n' if link_size != 2 else '',
+    '\n',
+    fill_array(f'static const uint8_t autocorrection_data[{len(data)}] '
+               'PROGMEM = {', data),
     '\n\n'])
 
   with open(file_name, 'wt') as f:
     f.write(generated_code)
 
 
+def fill_array(prefix: str, data: bytes) -> str:
+  """Formats a C array initializer, as textwrap.fill() would but faster."""
+  names = [str(b) for b in range(256)]
+  text = prefix + ', '.join(map(names.__getitem__, data)) + '};'
+  lines = []
+  start = 0
+  indent = ''
+  while len(indent) + len(text) - start > 80:
+    end = text.rfind(' ', start, start + 81 - len(indent))
+    lines.append(indent + text[start:end])
+    start = end + 1
+    indent = '  '
+  lines.append(indent + text[start:])
+  return '\n'.join(lines)
+
+
 def get_default_h_file(dict_file: str) -> str:
   return os.path.join(os.path.dirname(dict_file), 'autocorrection_data.h')
 
 
 def main(argv):
-  dict_file = argv[1] if len(argv) > 1 else 'autocorrection_dict.txt'
-  h_file = argv[2] if len(argv) > 2 else get_default_h_file(dict_file)
-
-  autocorrections = parse_file(dict_file)
-  trie = make_trie(autocorrections)
-  data = serialize_trie(autocorrections, trie)
-  print(f'Processed %d autocorrection entries to table with %d bytes.'
-        % (len(autocorrections), len(data)))
-  write_generated_code(autocorrections, data, h_file)
+  parser = argparse.ArgumentParser(
+      description='Makes autocorrection_data.h from a dictionary file.')
+  parser.add_argument('dict_file', nargs='?', default='autocorrection_dict.txt')
+  parser.add_argument('h_file', nargs='?')
+  parser.add_argument('--bitmap', action='store_true',
+                      help='index larger rows by a bitmap of symbols')
+  parser.add_argument('--fail-links', action='store_true',
+                      help='use failure links, otherwise chosen by size')
+  parser.add_argument('--words', action='append', default=[],
+                      help='word list file to check typos against')
+  parser.add_argument('--costs', action='store_true',
+                      help='print the bytes that each entry costs')
+  args = parser.parse_args(argv[1:])
+  h_file = args.h_file or get_default_h_file(args.dict_file)
+
+  autocorrections = parse_file(args.dict_file)
+  automaton = make_automaton(autocorrections)
+  check_substrings(automaton)
+  words = set(CORRECT_WORDS)
+  for file_name in args.words:
+    words.update(read_words(file_name))
+  check_words(automaton, words)
+
+  fail_links = True
+  table = serialize_automaton(automaton, args.bitmap, fail_links)
+  if not args.fail_links and len(automaton['leaf']) <= MAX_DFA_STATES:
+    dfa_table = serialize_automaton(automaton, args.bitmap, False)
+    if len(dfa_table['data']) <= len(table['data']):
+      fail_links = False
+      table = dfa_table
+  data = table['data']
+  print(f'Processed %d autocorrection entries to table with %d states and '
+        '%d bytes.' % (len(autocorrections), len(automaton['leaf']), len(data)))
+  costs = entry_costs(automaton, table['state_sizes'])
+  print('Flash usage: %d bytes, %.1f bytes per entry on average.' % (
+        len(data), len(data) / len(autocorrections)))
+  if len(costs) > NUM_COSTLIEST and not args.costs:
+    print(f'Costliest {NUM_COSTLIEST} entries (run with --costs to list all):')
+    costs = costs[:NUM_COSTLIEST]
+  else:
+    print('Bytes per entry:')
+  for cost, typo, correction in costs:
+    print(f'  {cost:7.1f}  {typo} -> {correction}')
+
+  write_generated_code(autocorrections, len(automaton['leaf']), args.bitmap,
+                       fail_links, table['link_size'], data, h_file)
 
 
 if __name__ == '__main__':
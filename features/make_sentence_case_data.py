@@ -0,0 +1,177 @@
+# Copyright 2026 Google LLC
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     https://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+"""Python program to make sentence_case_data.h.
+
+This program reads "sentence_case_dict.txt" from the current directory and
+generates a C source file "sentence_case_data.h" with a trie of abbreviations
+that don't end a sentence, which sentence_case.c matches against the last keys
+typed. Run this program without arguments like
+
+$ python3 make_sentence_case_data.py
+
+Or specify a dict file as the first argument, and optionally the output .h
+file, like
+
+$ python3 make_sentence_case_data.py mykeymap/sentence_case_dict.txt out.h
+
+Each line of the dict file is an abbreviation ending in '.', like "vs.", of
+letters a-z and "'". Case is ignored. Blank lines and text following '#' are
+ignored.
+
+The trie is over the abbreviations reversed, without the '.', so that it is
+walked from the latest key backwards, and all abbreviations are matched in one
+pass bounded by the longest. Each node is serialized as
+
+  match + n, symbol x n, link x n
+
+where match is 128 if an abbreviation ends at the node, n is the number of
+children, symbols are the children's keycodes in increasing order, and links
+are the 16-bit little-endian offsets of the children. The root is at offset 0.
+"""
+
+import os.path
+import sys
+from typing import Dict, List
+
+KC_A = 0x04
+KC_QUOT = 0x34
+
+ABBREV_CHARS = dict(
+  [("'", KC_QUOT)] +
+  # Characters a-z.
+  [(chr(c), c + KC_A - ord('a')) for c in range(ord('a'), ord('z') + 1)]
+)
+
+MATCH = 128
+
+
+def parse_file(file_name: str) -> List[str]:
+  """Parses the dict file to a list of abbreviations, without the '.'."""
+  abbrevs = []
+  with open(file_name, 'rt') as f:
+    for line_number, line in enumerate(f, 1):
+      line = line.split('#', 1)[0].strip().lower()
+      if not line:
+        continue
+      if not line.endswith('.') or len(line) < 2:
+        raise ValueError(f'{file_name}:{line_number}: Abbreviation must end '
+                         f'in \'.\': "{line}"')
+      word = line[:-1]
+      if '.' in word:
+        print(f'Warning:{file_name}:{line_number}: Skipping "{line}". Sentence '
+              'Case already treats letters after a \'.\' as an abbreviation.')
+        continue
+      if not ABBREV_CHARS.keys() >= set(word):
+        raise ValueError(f'{file_name}:{line_number}: Abbreviation "{line}" '
+                         'has characters other than '
+                         + ''.join(ABBREV_CHARS.keys()))
+      if word in abbrevs:
+        print(f'Warning:{file_name}:{line_number}: Ignoring duplicate "{line}"')
+        continue
+      abbrevs.append(word)
+
+  if not abbrevs:
+    raise ValueError(f'No abbreviations in "{file_name}".')
+  return abbrevs
+
+
+def serialize_trie(abbrevs: List[str]) -> List[int]:
+  """Serializes the reversed trie of `abbrevs` as a list of bytes."""
+  # Build the trie, with a node as a dict mapping a keycode to a child, and the
+  # key None marking that an abbreviation ends at the node.
+  root: Dict = {}
+  for word in abbrevs:
+    node = root
+    for c in reversed(word):
+      node = node.setdefault(ABBREV_CHARS[c], {})
+    node[None] = True
+
+  def children(node: Dict) -> List[int]:
+    return sorted(symbol for symbol in node if symbol is not None)
+
+  # Assign offsets in depth-first order.
+  nodes = []
+  offsets = {}
+  size = 0
+  stack = [root]
+  while stack:
+    node = stack.pop()
+    offsets[id(node)] = size
+    size += 1 + 3 * len(children(node))
+    nodes.append(node)
+    stack.extend(node[symbol] for symbol in reversed(children(node)))
+
+  data = []
+  for node in nodes:
+    symbols = children(node)
+    data.append((MATCH if None in node else 0) + len(symbols))
+    data.extend(symbols)
+    for symbol in symbols:
+      link = offsets[id(node[symbol])]
+      data.extend((link & 0xff, link >> 8))
+
+  if len(data) > 0xffff:
+    raise ValueError(f'Trie is {len(data)} bytes, exceeding 64KB.')
+  return data
+
+
+def write_generated_code(abbrevs: List[str], data: List[int],
+                         file_name: str) -> None:
+  """Writes the trie as generated C code to `file_name`."""
+  max_length = max(len(word) for word in abbrevs) + 1
+  generated_code = ''.join([
+      '// Generated code.\n\n',
+      f'// Sentence Case abbreviations ({len(abbrevs)} entries):\n',
+      ''.join(f'//   {word}.\n' for word in sorted(abbrevs)),
+      f'\n#define SENTENCE_CASE_ABBREV_MAX_LENGTH {max_length}\n\n',
+      fill_array(f'static const uint8_t sentence_case_abbrev_data[{len(data)}] '
+                 'PROGMEM = {', [str(b) for b in data]),
+      '\n',
+  ])
+
+  with open(file_name, 'wt') as f:
+    f.write(open(__file__, 'rt').read().split('\n\n', 1)[0]
+            .replace('#', '//') + '\n\n')
+    f.write(generated_code)
+
+
+def fill_array(prefix: str, items: List[str]) -> str:
+  """Formats a C array initializer wrapped to 80 columns."""
+  lines = []
+  line = prefix
+  for i, item in enumerate(items):
+    text = item + (', ' if i + 1 < len(items) else '};')
+    if len(line) + len(text.rstrip()) > 80:
+      lines.append(line.rstrip())
+      line = '  '
+    line += text
+  lines.append(line)
+  return '\n'.join(lines)
+
+
+def main(argv):
+  dict_file = argv[1] if len(argv) > 1 else 'sentence_case_dict.txt'
+  h_file = argv[2] if len(argv) > 2 else os.path.join(
+      os.path.dirname(dict_file), 'sentence_case_data.h')
+
+  abbrevs = parse_file(dict_file)
+  data = serialize_trie(abbrevs)
+  print(f'Processed {len(abbrevs)} abbreviations to a trie of {len(data)} '
+        'bytes.')
+  write_generated_code(abbrevs, data, h_file)
+
+
+if __name__ == '__main__':
+  main(sys.argv)
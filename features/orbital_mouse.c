@@ -22,6 +22,8 @@
 
 #include "orbital_mouse.h"
 
+#include "deadlines.h"
+
 #ifndef ORBITAL_MOUSE_RADIUS
 #define ORBITAL_MOUSE_RADIUS 36
 #endif  // ORBITAL_MOUSE_RADIUS
@@ -160,6 +162,7 @@ static int16_t scaled_cos(uint8_t amplitude, uint8_t phase) {
 static void wake_orbital_mouse_task(void) {
   if (!state.timer) {
     state.timer = timer_read() | 1;
+    deadline_set(orbital_mouse_task, state.timer);
   }
 }
 
@@ -361,6 +364,9 @@ void orbital_mouse_task(void) {
 
   // Schedule when task should run again, or go to sleep if inactive.
   state.timer = active ? ((now + ORBITAL_MOUSE_INTERVAL_MS) | 1) : 0;
+  if (active) {
+    deadline_set(orbital_mouse_task, state.timer);
+  }
 
   // Set whole part of movement deltas in report and retain fractional parts.
   state.report.x = state.x / 256;
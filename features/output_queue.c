@@ -0,0 +1,297 @@
+// Copyright 2026 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file output_queue.c
+ * @brief Output Queue implementation
+ */
+
+#include "output_queue.h"
+
+#ifdef OUTPUT_QUEUE_ENABLE
+
+#ifndef OUTPUT_QUEUE_SIZE
+#define OUTPUT_QUEUE_SIZE 64
+#endif  // OUTPUT_QUEUE_SIZE
+
+#if OUTPUT_QUEUE_SIZE < 4 || OUTPUT_QUEUE_SIZE > 255
+#error "output_queue: OUTPUT_QUEUE_SIZE must be between 4 and 255"
+#endif
+
+enum {
+  OP_REGISTER_CODE,
+  OP_UNREGISTER_CODE,
+  OP_SET_MODS,
+  OP_ADD_MODS,
+  OP_DEL_MODS,
+  OP_SET_WEAK_MODS,
+  OP_SEND_REPORT,
+  OP_WAIT,
+};
+
+static struct {
+  uint8_t op;
+  uint8_t arg;
+} queue[OUTPUT_QUEUE_SIZE];
+static uint8_t queue_head = 0;
+static uint8_t queue_size = 0;
+// While `waiting`, the next entry may not be applied before `next_time`.
+static bool waiting = false;
+static uint16_t next_time = 0;
+
+static void push(uint8_t op, uint8_t arg) {
+  if (queue_size >= OUTPUT_QUEUE_SIZE) {
+    output_queue_flush();  // Full, so make room the blocking way.
+  }
+  uint8_t i = queue_head + queue_size;
+  if (i >= OUTPUT_QUEUE_SIZE) {
+    i -= OUTPUT_QUEUE_SIZE;
+  }
+  queue[i].op = op;
+  queue[i].arg = arg;
+  ++queue_size;
+}
+
+/** Applies the oldest entry, returning how many ms to wait after it. */
+static uint8_t pop_and_apply(void) {
+  const uint8_t op = queue[queue_head].op;
+  const uint8_t arg = queue[queue_head].arg;
+  if (++queue_head >= OUTPUT_QUEUE_SIZE) {
+    queue_head = 0;
+  }
+  --queue_size;
+
+  switch (op) {
+    case OP_REGISTER_CODE:
+      register_code(arg);
+      // As with tap_code() and send_string(), only non-modifier keys are
+      // followed by a delay.
+      return IS_MODIFIER_KEYCODE(arg) ? 0 : TAP_CODE_DELAY;
+    case OP_UNREGISTER_CODE:
+      unregister_code(arg);
+      return IS_MODIFIER_KEYCODE(arg) ? 0 : TAP_CODE_DELAY;
+    case OP_SET_MODS:
+      set_mods(arg);
+      break;
+    case OP_ADD_MODS:
+      add_mods(arg);
+      break;
+    case OP_DEL_MODS:
+      del_mods(arg);
+      break;
+    case OP_SET_WEAK_MODS:
+      set_weak_mods(arg);
+      break;
+    case OP_SEND_REPORT:
+      send_keyboard_report();
+      break;
+    case OP_WAIT:
+      return arg;
+  }
+  return 0;
+}
+
+static void start_wait(uint8_t delay_ms) {
+  if (delay_ms) {
+    waiting = true;
+    next_time = timer_read() + delay_ms;
+  }
+}
+
+void output_queue_task(void) {
+  while (queue_size) {
+    if (waiting) {
+      if (!timer_expired(timer_read(), next_time)) {
+        return;
+      }
+      waiting = false;
+    }
+    start_wait(pop_and_apply());
+  }
+}
+
+void output_queue_flush(void) {
+  while (queue_size || waiting) {
+    if (waiting) {
+      const uint16_t now = timer_read();
+      if (!timer_expired(now, next_time)) {
+        wait_ms(TIMER_DIFF_16(next_time, now));
+      }
+      waiting = false;
+    }
+    if (queue_size) {
+      start_wait(pop_and_apply());
+    }
+  }
+}
+
+bool output_queue_is_empty(void) { return !queue_size; }
+
+/** Returns true for keycodes that process_output_queue() can hold back. */
+static bool is_queueable_key(uint16_t keycode) {
+  return (KC_A <= keycode && keycode <= KC_F24) ||
+         IS_MODIFIER_KEYCODE(keycode);
+}
+
+/** Returns true for layer keys, which send nothing themselves. */
+static bool is_layer_key(uint16_t keycode) {
+  return (QK_TO <= keycode && keycode <= QK_LAYER_TAP_TOGGLE_MAX &&
+          !IS_QK_ONE_SHOT_MOD(keycode));
+}
+
+void output_queue_pre_process(uint16_t keycode) {
+  // Tap-hold keys are undecided at this point, so they are left to
+  // process_output_queue() once resolved.
+  if (queue_size && !is_queueable_key(keycode) && !is_layer_key(keycode) &&
+      !IS_MOUSE_KEYCODE(keycode) && !IS_QK_MOD_TAP(keycode) &&
+      !IS_QK_LAYER_TAP(keycode)) {
+    output_queue_flush();
+  }
+}
+
+bool process_output_queue(uint16_t keycode, keyrecord_t* record) {
+  if (!queue_size) {
+    return true;  // Nothing pending, so handle the key as usual.
+  }
+
+  if (IS_QK_MOD_TAP(keycode) || IS_QK_LAYER_TAP(keycode)) {
+    if (record->tap.count) {
+      keycode = IS_QK_MOD_TAP(keycode) ? QK_MOD_TAP_GET_TAP_KEYCODE(keycode)
+                                       : QK_LAYER_TAP_GET_TAP_KEYCODE(keycode);
+    } else if (IS_QK_LAYER_TAP(keycode)) {
+      return true;  // Layer-tap hold, which only changes the layer.
+    }
+  }
+
+  if (is_queueable_key(keycode)) {
+    // Queue the key behind the pending output, so that it is sent in order
+    // without blocking. Weak and one-shot mods that apply to this key, as set
+    // for instance by Caps Word, are moved into the queue along with it.
+    const uint8_t mods = get_weak_mods() | get_oneshot_mods();
+    clear_weak_mods();
+    clear_oneshot_mods();
+    if (mods) {
+      push(OP_SET_WEAK_MODS, mods);
+    }
+    push(record->event.pressed ? OP_REGISTER_CODE : OP_UNREGISTER_CODE,
+         keycode);
+    if (mods) {
+      push(OP_SET_WEAK_MODS, 0);
+    }
+    return false;
+  }
+
+  if (!is_layer_key(keycode) && !IS_MOUSE_KEYCODE(keycode)) {
+    // Other keys, like a mod-tap hold, may send output of their own.
+    output_queue_flush();
+  }
+  return true;
+}
+
+void output_queue_register_code(uint8_t keycode) {
+  push(OP_REGISTER_CODE, keycode);
+}
+
+void output_queue_unregister_code(uint8_t keycode) {
+  push(OP_UNREGISTER_CODE, keycode);
+}
+
+void output_queue_tap_code(uint8_t keycode) {
+  push(OP_REGISTER_CODE, keycode);
+  push(OP_UNREGISTER_CODE, keycode);
+}
+
+void output_queue_set_mods(uint8_t mods) { push(OP_SET_MODS, mods); }
+
+void output_queue_add_mods(uint8_t mods) { push(OP_ADD_MODS, mods); }
+
+void output_queue_del_mods(uint8_t mods) { push(OP_DEL_MODS, mods); }
+
+void output_queue_register_mods(uint8_t mods) {
+  push(OP_ADD_MODS, mods);
+  push(OP_SEND_REPORT, 0);
+}
+
+void output_queue_unregister_mods(uint8_t mods) {
+  push(OP_DEL_MODS, mods);
+  push(OP_SEND_REPORT, 0);
+}
+
+void output_queue_send_keyboard_report(void) { push(OP_SEND_REPORT, 0); }
+
+static void push_char(uint8_t c) {
+  if (c >= 128) {
+    return;
+  }
+  const uint8_t keycode = pgm_read_byte(&ascii_to_keycode_lut[c]);
+  const bool shifted =
+      (pgm_read_byte(&ascii_to_shift_lut[c / 8]) >> (c % 8)) & 1;
+  if (shifted) {
+    push(OP_REGISTER_CODE, KC_LSFT);
+  }
+  output_queue_tap_code(keycode);
+  if (shifted) {
+    push(OP_UNREGISTER_CODE, KC_LSFT);
+  }
+}
+
+void output_queue_send_string_P(const char* str) {
+  for (;;) {
+    uint8_t c = pgm_read_byte(str++);
+    if (!c) {
+      break;
+    } else if (c != SS_QMK_PREFIX) {
+      push_char(c);
+    } else {
+      c = pgm_read_byte(str++);
+      if (c == SS_DELAY_CODE) {
+        // Parse "<ms>|", saturating to the 255 ms that an entry holds.
+        uint16_t ms = 0;
+        while ((c = pgm_read_byte(str)) && c != '|') {
+          ++str;
+          if ('0' <= c && c <= '9' && ms < 255) {
+            ms = 10 * ms + (c - '0');
+          }
+        }
+        if (c) {
+          ++str;  // Skip '|'.
+        }
+        push(OP_WAIT, ms < 255 ? ms : 255);
+      } else {
+        const uint8_t keycode = c ? pgm_read_byte(str++) : 0;
+        if (!keycode) {
+          break;
+        }
+        switch (c) {
+          case SS_TAP_CODE:
+            output_queue_tap_code(keycode);
+            break;
+          case SS_DOWN_CODE:
+            push(OP_REGISTER_CODE, keycode);
+            break;
+          case SS_UP_CODE:
+            push(OP_UNREGISTER_CODE, keycode);
+            break;
+        }
+        // send_string() pauses after every code, including modifiers.
+        if (c != SS_TAP_CODE && IS_MODIFIER_KEYCODE(keycode) &&
+            TAP_CODE_DELAY > 0) {
+          push(OP_WAIT, TAP_CODE_DELAY);
+        }
+      }
+    }
+  }
+}
+
+#endif  // OUTPUT_QUEUE_ENABLE
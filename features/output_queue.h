@@ -0,0 +1,194 @@
+// Copyright 2026 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file output_queue.h
+ * @brief Output Queue - non-blocking paced key output
+ *
+ * Overview
+ * --------
+ *
+ * Macros that type several keys, like autocorrections, call tap_code() and
+ * send_string(), which block in wait_ms() for `TAP_CODE_DELAY` ms per key.
+ * While blocked, the keyboard doesn't scan the matrix or run tasks, so that
+ * for instance a correction of 8 characters with the 5 ms delay stalls the
+ * keyboard for 80 ms.
+ *
+ * Output Queue instead appends such output to a bounded ring buffer, which is
+ * drained from housekeeping, applying one key press or release every
+ * `TAP_CODE_DELAY` ms. Mod changes and report sends in between keys are
+ * applied immediately, so that the host sees the same sequence of reports as
+ * with the blocking calls.
+ *
+ * Key events that arrive while output is pending are handled so that the
+ * output stays in order without stalling the keyboard:
+ *
+ * - Layer keys and mouse keys are handled right away, since they don't type.
+ * - Basic keys and modifiers, including tapped mod-taps, are appended to the
+ *   queue along with any weak and one-shot mods on them.
+ * - Other keys flush the queue first, applying the pending output and
+ *   blocking for what remains of it.
+ *
+ * If the buffer fills, it is likewise flushed, so that an enqueue never fails.
+ *
+ * Handlers that run after process_output_queue(), like QMK's core
+ * Autocorrect, don't see the keys that it queues. Handlers that run before it
+ * and send output for basic keys themselves, like Custom Shift Keys, should
+ * send it through the queue.
+ *
+ *
+ * Add it to your keymap
+ * ---------------------
+ *
+ * In rules.mk, set `OUTPUT_QUEUE_ENABLE = yes`. Then in keymap.c, add
+ *
+ *     #include "features/output_queue.h"
+ *
+ *     bool pre_process_record_user(uint16_t keycode, keyrecord_t* record) {
+ *       output_queue_pre_process(keycode);
+ *       return true;
+ *     }
+ *
+ *     bool process_record_user(uint16_t keycode, keyrecord_t* record) {
+ *       // Your macros...
+ *       if (!process_output_queue(keycode, record)) { return false; }
+ *       return true;
+ *     }
+ *
+ *     void housekeeping_task_user(void) {
+ *       output_queue_task();
+ *       // Other tasks...
+ *     }
+ *
+ * and in macros, replace blocking calls with their queued counterparts:
+ *
+ *     tap_code(kc)           -->  output_queue_tap_code(kc)
+ *     register_code(kc)      -->  output_queue_register_code(kc)
+ *     send_string_P(str)     -->  output_queue_send_string_P(str)
+ *     send_keyboard_report() -->  output_queue_send_keyboard_report()
+ *
+ * Modifier changes that are interleaved with queued keys must be queued too,
+ * using output_queue_set_mods(), output_queue_add_mods(), etc. When
+ * `OUTPUT_QUEUE_ENABLE` is not defined, these functions fall back to the
+ * corresponding blocking calls, so code using them works either way.
+ *
+ * The buffer size is set by `OUTPUT_QUEUE_SIZE` (default 64 entries, 2 bytes
+ * each). A character that needs Shift takes 4 entries.
+ */
+
+#pragma once
+
+#include "quantum.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifdef OUTPUT_QUEUE_ENABLE
+
+/** Drains queued output. Call from housekeeping_task_user(). */
+void output_queue_task(void);
+
+/** Applies all queued output now, blocking to pace it as usual. */
+void output_queue_flush(void);
+
+/** Returns true if no output is pending. */
+bool output_queue_is_empty(void);
+
+/**
+ * Flushes pending output before a key event that process_output_queue() can't
+ * order behind it. Call from pre_process_record_user().
+ */
+void output_queue_pre_process(uint16_t keycode);
+
+/**
+ * Handler function for Output Queue. While output is pending, queues basic
+ * keys behind it and returns false. Call at the end of process_record_user().
+ */
+bool process_output_queue(uint16_t keycode, keyrecord_t* record);
+
+/** Queues a key press. */
+void output_queue_register_code(uint8_t keycode);
+
+/** Queues a key release. */
+void output_queue_unregister_code(uint8_t keycode);
+
+/** Queues a tap of a basic keycode. */
+void output_queue_tap_code(uint8_t keycode);
+
+/** Queues set_mods(). As with set_mods(), no report is sent. */
+void output_queue_set_mods(uint8_t mods);
+
+/** Queues add_mods(). */
+void output_queue_add_mods(uint8_t mods);
+
+/** Queues del_mods(). */
+void output_queue_del_mods(uint8_t mods);
+
+/** Queues register_mods(), i.e. add_mods() and sending a report. */
+void output_queue_register_mods(uint8_t mods);
+
+/** Queues unregister_mods(). */
+void output_queue_unregister_mods(uint8_t mods);
+
+/** Queues sending the keyboard report. */
+void output_queue_send_keyboard_report(void);
+
+/**
+ * Queues typing a PROGMEM string, like send_string_with_delay_P() with
+ * `TAP_CODE_DELAY` as the interval. The string may contain SS_TAP, SS_DOWN,
+ * SS_UP, and SS_DELAY codes.
+ */
+void output_queue_send_string_P(const char* str);
+
+#else
+
+static inline void output_queue_task(void) {}
+static inline void output_queue_flush(void) {}
+static inline bool output_queue_is_empty(void) { return true; }
+static inline void output_queue_pre_process(uint16_t keycode) {}
+static inline bool process_output_queue(uint16_t keycode,
+                                        keyrecord_t* record) {
+  return true;
+}
+static inline void output_queue_register_code(uint8_t keycode) {
+  register_code(keycode);
+}
+static inline void output_queue_unregister_code(uint8_t keycode) {
+  unregister_code(keycode);
+}
+static inline void output_queue_tap_code(uint8_t keycode) {
+  tap_code(keycode);
+}
+static inline void output_queue_set_mods(uint8_t mods) { set_mods(mods); }
+static inline void output_queue_add_mods(uint8_t mods) { add_mods(mods); }
+static inline void output_queue_del_mods(uint8_t mods) { del_mods(mods); }
+static inline void output_queue_register_mods(uint8_t mods) {
+  register_mods(mods);
+}
+static inline void output_queue_unregister_mods(uint8_t mods) {
+  unregister_mods(mods);
+}
+static inline void output_queue_send_keyboard_report(void) {
+  send_keyboard_report();
+}
+static inline void output_queue_send_string_P(const char* str) {
+  send_string_with_delay_P(str, TAP_CODE_DELAY);
+}
+
+#endif  // OUTPUT_QUEUE_ENABLE
+
+#ifdef __cplusplus
+}
+#endif
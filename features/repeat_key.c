@@ -19,6 +19,8 @@
 
 #include "repeat_key.h"
 
+#include "output_queue.h"
+
 #pragma message \
     "Repeat Key is now a core QMK feature! To use it, update your QMK set up and see https://docs.qmk.fm/features/repeat_key"
 
@@ -46,6 +48,20 @@ static int8_t last_repeat_count = 0;
 // nonzero only while a repeated key is being processed.
 static int8_t processing_repeat_count = 0;
 
+#if REPEAT_KEY_HISTORY_SIZE < 1 || REPEAT_KEY_HISTORY_SIZE > 255
+#error "repeat_key: REPEAT_KEY_HISTORY_SIZE must be between 1 and 255"
+#endif
+
+// Ring buffer of recently pressed keys, including repeats, for replaying.
+static struct {
+  uint16_t keycode;
+  uint8_t mods;
+  // Whether a tap-hold key was tapped.
+  bool tapped;
+} history[REPEAT_KEY_HISTORY_SIZE];
+static uint8_t history_newest = REPEAT_KEY_HISTORY_SIZE - 1;
+static uint8_t history_size = 0;
+
 /** @brief Updates `last_repeat_count` in direction `dir`. */
 static void update_last_repeat_count(int8_t dir) {
   if (dir * last_repeat_count < 0) {
@@ -61,6 +77,62 @@ static void set_last_record(uint16_t keycode, keyrecord_t* record) {
   last_repeat_count = 0;
 }
 
+static void push_history(uint16_t keycode, const keyrecord_t* record,
+                         uint8_t mods) {
+  if (++history_newest >= REPEAT_KEY_HISTORY_SIZE) {
+    history_newest = 0;
+  }
+  if (history_size < REPEAT_KEY_HISTORY_SIZE) {
+    ++history_size;
+  }
+  history[history_newest].keycode = keycode;
+  history[history_newest].mods = mods;
+#ifndef NO_ACTION_TAPPING
+  history[history_newest].tapped = record->tap.count != 0;
+#else
+  history[history_newest].tapped = false;
+#endif  // NO_ACTION_TAPPING
+}
+
+/** Index into `history` of the i-th newest entry, i = 0 being the newest. */
+static uint8_t history_index(uint8_t i) {
+  return (history_newest >= i) ? history_newest - i
+                               : history_newest + REPEAT_KEY_HISTORY_SIZE - i;
+}
+
+/**
+ * Gets the basic keycode that the i-th newest history entry typed, and adds
+ * its mods to `mods`. Returns KC_NO if it didn't type a basic keycode.
+ */
+static uint8_t history_basic_keycode(uint8_t i, uint8_t* mods) {
+  i = history_index(i);
+  uint16_t keycode = history[i].keycode;
+  *mods |= history[i].mods;
+
+  switch (keycode) {
+    case QK_MODS ... QK_MODS_MAX: {  // Unpack modifier + basic key.
+      // Convert 5-bit mods to 8-bit.
+      const uint8_t mods5 = QK_MODS_GET_MODS(keycode);
+      *mods |= (mods5 & 0x10) ? ((mods5 & 0xf) << 4) : mods5;
+      keycode = QK_MODS_GET_BASIC_KEYCODE(keycode);
+    } break;
+
+#ifndef NO_ACTION_TAPPING
+    case QK_MOD_TAP ... QK_MOD_TAP_MAX:
+      keycode = history[i].tapped ? QK_MOD_TAP_GET_TAP_KEYCODE(keycode) : KC_NO;
+      break;
+#ifndef NO_ACTION_LAYER
+    case QK_LAYER_TAP ... QK_LAYER_TAP_MAX:
+      keycode =
+          history[i].tapped ? QK_LAYER_TAP_GET_TAP_KEYCODE(keycode) : KC_NO;
+      break;
+#endif  // NO_ACTION_LAYER
+#endif  // NO_ACTION_TAPPING
+  }
+
+  return IS_QK_BASIC(keycode) ? keycode : KC_NO;
+}
+
 static void repeat_key_invoke(const keyevent_t* event) {
   // It is possible (e.g. in rolled presses) that the last key changes while the
   // Repeat Key is pressed. To prevent stuck keys, it is important to remember
@@ -77,6 +149,7 @@ static void repeat_key_invoke(const keyevent_t* event) {
 
   if (event->pressed) {
     update_last_repeat_count(1);
+    push_history(last_record.keycode, &last_record, last_mods | get_mods());
     // On press, apply the last mods state, stacking on top of current mods.
     register_weak_mods(last_mods);
     registered_record = last_record;
@@ -148,6 +221,7 @@ static void alt_repeat_key_invoke(const keyevent_t* event) {
   if (event->pressed) {
     update_last_repeat_count(-1);
     registered_repeat_count = last_repeat_count;
+    push_history(registered_record.keycode, &registered_record, get_mods());
   }
 
   // Generate a keyrecord and plumb it into the event pipeline.
@@ -227,6 +301,7 @@ bool process_repeat_key(uint16_t keycode, keyrecord_t* record,
     if (remember_last_key_wrapper(keycode, record, &remembered_mods)) {
       set_last_record(keycode, record);
       set_last_mods(remembered_mods);
+      push_history(keycode, record, remembered_mods);
     }
   }
 
@@ -375,6 +450,62 @@ uint16_t get_alt_repeat_key_keycode(void) {
   return KC_NO;  // No alternate key found.
 }
 
+uint8_t get_repeat_key_history_size(void) { return history_size; }
+
+uint16_t get_last_keycode_at(uint8_t i) {
+  return (i < history_size) ? history[history_index(i)].keycode : KC_NO;
+}
+
+uint8_t get_last_mods_at(uint8_t i) {
+  return (i < history_size) ? history[history_index(i)].mods : 0;
+}
+
+/**
+ * Queues typing history entries `newest` (inclusive) through `oldest`
+ * (exclusive), oldest first, each with its mods. Returns the number of keys.
+ */
+static uint8_t replay_history(uint8_t newest, uint8_t oldest) {
+  const uint8_t saved_mods = get_mods();
+  uint8_t replayed = 0;
+  for (uint8_t i = oldest; i-- > newest;) {
+    uint8_t mods = 0;
+    const uint8_t keycode = history_basic_keycode(i, &mods);
+    if (keycode) {
+      output_queue_set_mods(mods);
+      output_queue_tap_code(keycode);
+      ++replayed;
+    }
+  }
+  if (replayed) {
+    output_queue_set_mods(saved_mods);
+    output_queue_send_keyboard_report();
+  }
+  return replayed;
+}
+
+uint8_t repeat_key_replay(uint8_t count) {
+  return replay_history(0, (count < history_size) ? count : history_size);
+}
+
+static bool is_word_key(uint8_t i) {
+  uint8_t mods = 0;
+  const uint8_t keycode = history_basic_keycode(i, &mods);
+  return (KC_A <= keycode && keycode <= KC_0) || keycode == KC_QUOT;
+}
+
+uint8_t repeat_key_replay_word(void) {
+  uint8_t newest = 0;
+  // Skip keys typed after the word, like a space.
+  while (newest < history_size && !is_word_key(newest)) {
+    ++newest;
+  }
+  uint8_t oldest = newest;
+  while (oldest < history_size && is_word_key(oldest)) {
+    ++oldest;
+  }
+  return replay_history(newest, oldest);
+}
+
 void repeat_key_register(void) {
   repeat_key_invoke(&MAKE_KEYEVENT(0, 0, true));
 }
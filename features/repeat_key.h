@@ -47,6 +47,14 @@
 extern "C" {
 #endif
 
+#ifndef REPEAT_KEY_HISTORY_SIZE
+#ifdef __AVR__
+#define REPEAT_KEY_HISTORY_SIZE 1
+#else
+#define REPEAT_KEY_HISTORY_SIZE 16
+#endif  // __AVR__
+#endif  // REPEAT_KEY_HISTORY_SIZE
+
 /**
  * Handler function for Repeat Key. Call either this function or
  * `process_repeat_key_with_rev()` (but not both) from `process_record_user()`
@@ -90,6 +98,38 @@ void set_last_keycode(uint16_t keycode);
 /** @brief Sets the last mods. */
 void set_last_mods(uint8_t mods);
 
+/**
+ * @brief Number of keys in the history, up to `REPEAT_KEY_HISTORY_SIZE`.
+ *
+ * Besides the last key, Repeat Key keeps a history of recently pressed keys in
+ * a ring buffer of `REPEAT_KEY_HISTORY_SIZE` entries, 4 bytes each (default
+ * 16, or 1 on AVR). It holds the keys that are remembered as the last key, as
+ * well as repeated and alternate-repeated keys, each with its mods.
+ */
+uint8_t get_repeat_key_history_size(void);
+/** @brief Keycode of the i-th most recent key, i = 0 being the last key. */
+uint16_t get_last_keycode_at(uint8_t i);
+/** @brief Mods that were active with the i-th most recent key. */
+uint8_t get_last_mods_at(uint8_t i);
+
+/**
+ * @brief Types the last `count` keys again, returning how many were typed.
+ *
+ * Unlike the Repeat Key, which replays one key through the event pipeline,
+ * the keys are typed in one burst through Output Queue (see output_queue.h),
+ * each with the mods it was pressed with. Keys that don't type a basic
+ * keycode, e.g. macros, are skipped.
+ */
+uint8_t repeat_key_replay(uint8_t count);
+
+/**
+ * @brief Types the last word again, returning its number of keys.
+ *
+ * The word is the most recent run of letter, digit, and apostrophe keys. Keys
+ * typed after it, like a space, are not replayed.
+ */
+uint8_t repeat_key_replay_word(void);
+
 /**
  * @brief Callback defining which keys are remembered.
  *
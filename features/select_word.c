@@ -22,6 +22,9 @@
 
 #include "select_word.h"
 
+#include "deadlines.h"
+#include "output_queue.h"
+
 #if !defined(IS_QK_MOD_TAP)
 // Attempt to detect out-of-date QMK installation, which would fail with
 // implicit-function-declaration errors in the code below.
@@ -83,6 +86,7 @@ static uint16_t idle_timer = 0;
 
 static void restart_idle_timer(void) {
   idle_timer = (timer_read() + SELECT_WORD_TIMEOUT) | 1;
+  deadline_set(select_word_task, idle_timer);
 }
 
 void select_word_task(void) {
@@ -93,8 +97,11 @@ void select_word_task(void) {
 }
 #endif  // SELECT_WORD_TIMEOUT > 0
 
+// Output goes through Output Queue, which with OUTPUT_QUEUE_ENABLE is paced
+// from housekeeping instead of blocking. Mod changes interleaved with the
+// output are queued along with it to apply in order.
 static void clear_all_mods(void) {
-  clear_mods();
+  output_queue_set_mods(0);
   clear_weak_mods();
 #ifndef NO_ACTION_ONESHOT
   clear_oneshot_mods();
@@ -120,25 +127,24 @@ static void select_word_in_dir(int8_t dir) {
   clear_all_mods();
 
   if (selection_dir && (selection_dir < 0) != (dir < 0)) {  // Reversal.
-    send_keyboard_report();
-    tap_code_delay((dir < 0) ? KC_RGHT : KC_LEFT, TAP_CODE_DELAY);
+    output_queue_send_keyboard_report();
+    output_queue_tap_code((dir < 0) ? KC_RGHT : KC_LEFT);
   }
 
-  add_mods(IS_MAC ? MOD_BIT_LALT : MOD_BIT_LCTRL);
+  output_queue_add_mods(IS_MAC ? MOD_BIT_LALT : MOD_BIT_LCTRL);
 
   if (selection_dir == 0) {  // Initial selection.
-    send_keyboard_report();
-    send_string_with_delay_P(
-        (dir < 0) ? PSTR(SS_TAP(X_LEFT) SS_TAP(X_RGHT))
-                  : PSTR(SS_TAP(X_RGHT) SS_TAP(X_LEFT)),
-        TAP_CODE_DELAY);
+    output_queue_send_keyboard_report();
+    output_queue_send_string_P((dir < 0)
+                                   ? PSTR(SS_TAP(X_LEFT) SS_TAP(X_RGHT))
+                                   : PSTR(SS_TAP(X_RGHT) SS_TAP(X_LEFT)));
   }
 
-  register_mods(MOD_BIT_LSHIFT);
+  output_queue_register_mods(MOD_BIT_LSHIFT);
   registered_hotkey = (dir < 0) ? KC_LEFT : KC_RGHT;
-  register_code(registered_hotkey);
+  output_queue_register_code(registered_hotkey);
 
-  set_mods(saved_mods);
+  output_queue_set_mods(saved_mods);
   selection_dir = dir;
 }
 
@@ -157,18 +163,17 @@ static void select_line(void) {
   clear_all_mods();
 
   if (selection_dir != 2) {
-    send_keyboard_report();
-    send_string_with_delay_P(
+    output_queue_send_keyboard_report();
+    output_queue_send_string_P(
         IS_MAC ? PSTR(SS_LGUI(SS_TAP(X_LEFT) SS_LSFT(SS_TAP(X_RGHT))))
-               : PSTR(SS_TAP(X_HOME) SS_LSFT(SS_TAP(X_END))),
-        TAP_CODE_DELAY);
+               : PSTR(SS_TAP(X_HOME) SS_LSFT(SS_TAP(X_END))));
   } else {
-    register_mods(MOD_BIT_LSHIFT);
+    output_queue_register_mods(MOD_BIT_LSHIFT);
     registered_hotkey = KC_DOWN;
-    register_code(KC_DOWN);
+    output_queue_register_code(KC_DOWN);
   }
 
-  set_mods(saved_mods);
+  output_queue_set_mods(saved_mods);
   selection_dir = 2;
 }
 
@@ -191,12 +196,13 @@ void select_word_register(char action) {
 
 #if SELECT_WORD_TIMEOUT > 0
   idle_timer = 0;
+  deadline_cancel(select_word_task);
 #endif  // SELECT_WORD_TIMEOUT > 0
 }
 
 void select_word_unregister(void) {
   reset_before_next_event = false;
-  unregister_code(registered_hotkey);
+  output_queue_unregister_code(registered_hotkey);
 
   if (registered_hotkey == KC_DOWN) {
     // When using line selection to select multiple lines, tap Shift+End (or on
@@ -204,12 +210,10 @@ void select_word_unregister(void) {
     // end of the current line.
     const uint8_t saved_mods = get_mods();
     clear_all_mods();
-    send_keyboard_report();
-    send_string_with_delay_P(
-        IS_MAC ? PSTR(SS_LGUI(SS_LSFT(SS_TAP(X_RGHT))))
-               : PSTR(SS_LSFT(SS_TAP(X_END))),
-        TAP_CODE_DELAY);
-    set_mods(saved_mods);
+    output_queue_send_keyboard_report();
+    output_queue_send_string_P(IS_MAC ? PSTR(SS_LGUI(SS_LSFT(SS_TAP(X_RGHT))))
+                                      : PSTR(SS_LSFT(SS_TAP(X_END))));
+    output_queue_set_mods(saved_mods);
   }
 
   registered_hotkey = KC_NO;
@@ -24,6 +24,18 @@
 
 #include <string.h>
 
+#include "deadlines.h"
+#include "key_context.h"
+
+#if SENTENCE_CASE_BUFFER_SIZE > 1
+// SENTENCE_CASE_DATA_FILE may name another generated table of abbreviations.
+#ifdef SENTENCE_CASE_DATA_FILE
+#include SENTENCE_CASE_DATA_FILE
+#else
+#include "sentence_case_data.h"
+#endif  // SENTENCE_CASE_DATA_FILE
+#endif  // SENTENCE_CASE_BUFFER_SIZE > 1
+
 #if !defined(IS_QK_MOD_TAP)
 // Attempt to detect out-of-date QMK installation, which would fail with
 // implicit-function-declaration errors in the code below.
@@ -35,8 +47,24 @@
 #error "sentence_case: Please enable oneshot."
 #else
 
-// Number of keys of state history to retain for backspacing.
-#define STATE_HISTORY_SIZE 6
+#if SENTENCE_CASE_BUFFER_SIZE > 128
+#error "sentence_case: SENTENCE_CASE_BUFFER_SIZE must be at most 128"
+#endif
+
+#if SENTENCE_CASE_BUFFER_SIZE > 1
+#ifdef KEY_CONTEXT_ENABLE
+// With Key Context, the typed keys are read from its shared buffer, which must
+// be at least SENTENCE_CASE_BUFFER_SIZE.
+#if KEY_CONTEXT_BUFFER_SIZE < SENTENCE_CASE_BUFFER_SIZE
+#error "sentence_case: KEY_CONTEXT_BUFFER_SIZE is too small"
+#endif
+#else
+#define OWN_KEY_BUFFER
+#endif  // KEY_CONTEXT_ENABLE
+#endif  // SENTENCE_CASE_BUFFER_SIZE > 1
+
+// Number of keys of state history to retain for backspacing. A power of 2.
+#define STATE_HISTORY_SIZE 8
 
 // clang-format off
 /** States in matching the beginning of a sentence. */
@@ -48,15 +76,76 @@ enum {
   STATE_PRIMED,   /**< "Primed" state, in the space following an ending. */
   STATE_DISABLED, /**< Sentence Case is disabled. */
 };
+
+/** Classes of keys, from the char codes of `sentence_case_press_user()`. */
+enum {
+  CLASS_LETTER,  /**< 'a' */
+  CLASS_ENDING,  /**< '.' */
+  CLASS_SPACE,   /**< ' ' */
+  CLASS_QUOTE,   /**< '\'' */
+  CLASS_SYMBOL,  /**< '#' */
+  NUM_CLASSES,
+};
+
+/** Actions flagged in the upper bits of transition table entries. */
+enum {
+  STATE_MASK = 0x0f,
+  /** Capitalize the key, unless it is `suppress_key`. */
+  ACTION_CAPITALIZE = 0x10,
+  /** Go to STATE_INIT instead if sentence_case_check_ending() is false. */
+  ACTION_CHECK_ENDING = 0x20,
+  /** Clear `suppress_key`. */
+  ACTION_UNSUPPRESS = 0x40,
+};
+
+/**
+ * State transition table, indexed by the current state and key class. We
+ * search for sentence beginnings with this finite state machine. It matches
+ * things like "a. a" and "a.  a" but not "a.. a" or "a.a. a". The transitions
+ * are:
+ *
+ *             'a'       '.'      ' '      '\''     '#'
+ *           +----------------------------------------------
+ *   INIT    | WORD      ABBREV   INIT     INIT     INIT
+ *   WORD    | WORD      ENDING*  INIT     WORD     INIT
+ *   ABBREV  | ABBREV    ABBREV   INIT     ABBREV   INIT
+ *   ENDING  | ABBREV    ABBREV   PRIMED   ENDING   INIT
+ *   PRIMED  | match!    ABBREV   PRIMED   PRIMED   INIT
+ *
+ * where "ENDING*" goes to ENDING if sentence_case_check_ending() is true and
+ * to INIT otherwise, and "match!" capitalizes the letter and goes to WORD.
+ */
+static const uint8_t transitions[STATE_DISABLED][NUM_CLASSES] PROGMEM = {
+  [STATE_INIT] =
+    {STATE_WORD, STATE_ABBREV, STATE_INIT, STATE_INIT, STATE_INIT},
+  [STATE_WORD] =
+    {STATE_WORD, STATE_ENDING | ACTION_CHECK_ENDING, STATE_INIT, STATE_WORD,
+     STATE_INIT},
+  [STATE_ABBREV] =
+    {STATE_ABBREV, STATE_ABBREV, STATE_INIT, STATE_ABBREV, STATE_INIT},
+  [STATE_ENDING] =
+    {STATE_ABBREV, STATE_ABBREV, STATE_PRIMED | ACTION_UNSUPPRESS,
+     STATE_ENDING, STATE_INIT},
+  [STATE_PRIMED] =
+    {STATE_WORD | ACTION_CAPITALIZE, STATE_ABBREV,
+     STATE_PRIMED | ACTION_UNSUPPRESS, STATE_PRIMED, STATE_INIT},
+};
 // clang-format on
 
 #if SENTENCE_CASE_TIMEOUT > 0
 static uint16_t idle_timer = 0;
 #endif  // SENTENCE_CASE_TIMEOUT > 0
-#if SENTENCE_CASE_BUFFER_SIZE > 1
-static uint16_t key_buffer[SENTENCE_CASE_BUFFER_SIZE] = {0};
-#endif  // SENTENCE_CASE_BUFFER_SIZE > 1
+#ifdef OWN_KEY_BUFFER
+// Ring buffer of the last SENTENCE_CASE_BUFFER_SIZE keys, the latest at
+// `key_head`. Each key is stored twice, at `key_head` and at
+// `key_head + SENTENCE_CASE_BUFFER_SIZE`, so that the keys in order from oldest
+// to latest are always contiguous, starting at `key_buffer + key_head + 1`.
+static uint16_t key_buffer[2 * SENTENCE_CASE_BUFFER_SIZE] = {0};
+static uint8_t key_head = 0;
+#endif  // OWN_KEY_BUFFER
+// Ring buffer of states before each key, the latest at `state_head`.
 static uint8_t state_history[STATE_HISTORY_SIZE];
+static uint8_t state_head = 0;
 static uint16_t suppress_key = KC_NO;
 static uint8_t sentence_state = STATE_INIT;
 
@@ -81,6 +170,7 @@ static void set_sentence_state(uint8_t new_state) {
 static void clear_state_history(void) {
 #if SENTENCE_CASE_TIMEOUT > 0
   idle_timer = 0;
+  deadline_cancel(sentence_case_task);
 #endif  // SENTENCE_CASE_TIMEOUT > 0
   memset(state_history, STATE_INIT, sizeof(state_history));
   if (sentence_state != STATE_DISABLED) {
@@ -91,11 +181,32 @@ static void clear_state_history(void) {
 void sentence_case_clear(void) {
   clear_state_history();
   suppress_key = KC_NO;
-#if SENTENCE_CASE_BUFFER_SIZE > 1
+#ifdef OWN_KEY_BUFFER
   memset(key_buffer, 0, sizeof(key_buffer));
-#endif  // SENTENCE_CASE_BUFFER_SIZE > 1
+  key_head = 0;
+#endif  // OWN_KEY_BUFFER
 }
 
+#ifdef OWN_KEY_BUFFER
+/** Sets the key at `key_head` in both halves of the ring. */
+static void set_key(uint16_t keycode) {
+  key_buffer[key_head] = keycode;
+  key_buffer[key_head + SENTENCE_CASE_BUFFER_SIZE] = keycode;
+}
+#endif  // OWN_KEY_BUFFER
+
+#if SENTENCE_CASE_BUFFER_SIZE > 1
+/** Gets the last SENTENCE_CASE_BUFFER_SIZE keys, from oldest to latest. */
+static const uint16_t* get_key_buffer(void) {
+#ifdef OWN_KEY_BUFFER
+  return key_buffer + key_head + 1;
+#else
+  return get_key_context_buffer() + KEY_CONTEXT_BUFFER_SIZE -
+         SENTENCE_CASE_BUFFER_SIZE;
+#endif  // OWN_KEY_BUFFER
+}
+#endif  // SENTENCE_CASE_BUFFER_SIZE > 1
+
 void sentence_case_on(void) {
   if (sentence_state == STATE_DISABLED) {
     sentence_state = STATE_INIT;
@@ -142,8 +253,18 @@ bool process_sentence_case(uint16_t keycode, keyrecord_t* record) {
 
 #if SENTENCE_CASE_TIMEOUT > 0
   idle_timer = (record->event.time + SENTENCE_CASE_TIMEOUT) | 1;
+  deadline_set(sentence_case_task, idle_timer);
 #endif  // SENTENCE_CASE_TIMEOUT > 0
 
+#ifdef KEY_CONTEXT_ENABLE
+  // Key Context has unpacked the tap keycode of a tapped tap-hold key, or
+  // KC_NO if held.
+  keycode = get_key_context_keycode();
+  if (keycode == KC_NO) {
+    return true;
+  }
+#endif  // KEY_CONTEXT_ENABLE
+
   switch (keycode) {
     case KC_LCTL ... KC_RGUI:  // Ignore mod keys.
     case QK_ONE_SHOT_MOD ... QK_ONE_SHOT_MOD_MAX:  // Ignore one-shot mod.
@@ -159,6 +280,7 @@ bool process_sentence_case(uint16_t keycode, keyrecord_t* record) {
 #endif  // TRI_LAYER_ENABLE
       return true;
 
+#ifndef KEY_CONTEXT_ENABLE
 #ifndef NO_ACTION_TAPPING
     case QK_MOD_TAP ... QK_MOD_TAP_MAX:
       if (record->tap.count == 0) {
@@ -184,115 +306,79 @@ bool process_sentence_case(uint16_t keycode, keyrecord_t* record) {
       keycode = QK_SWAP_HANDS_GET_TAP_KEYCODE(keycode);
       break;
 #endif  // SWAP_HANDS_ENABLE
+#endif  // KEY_CONTEXT_ENABLE
   }
 
   if (keycode == KC_BSPC) {
     // Backspace key pressed. Rewind the state and key buffers.
-    set_sentence_state(state_history[STATE_HISTORY_SIZE - 1]);
-
-    memmove(state_history + 1, state_history, STATE_HISTORY_SIZE - 1);
-    state_history[0] = STATE_INIT;
-#if SENTENCE_CASE_BUFFER_SIZE > 1
-    memmove(key_buffer + 1, key_buffer,
-            (SENTENCE_CASE_BUFFER_SIZE - 1) * sizeof(uint16_t));
-    key_buffer[0] = KC_NO;
-#endif  // SENTENCE_CASE_BUFFER_SIZE > 1
+    set_sentence_state(state_history[state_head]);
+    state_history[state_head] = STATE_INIT;
+    state_head = (state_head - 1) & (STATE_HISTORY_SIZE - 1);
+#ifdef OWN_KEY_BUFFER
+    set_key(KC_NO);
+    key_head = (key_head ? key_head : SENTENCE_CASE_BUFFER_SIZE) - 1;
+#endif  // OWN_KEY_BUFFER
     return true;
   }
 
   const uint8_t mods = get_mods() | get_weak_mods() | get_oneshot_mods();
-  uint8_t new_state = STATE_INIT;
-
-  // We search for sentence beginnings using a simple finite state machine. It
-  // matches things like "a. a" and "a.  a" but not "a.. a" or "a.a. a". The
-  // state transition matrix is:
-  //
-  //             'a'       '.'      ' '      '\''
-  //           +-------------------------------------
-  //   INIT    | WORD      INIT     INIT     INIT
-  //   WORD    | WORD      ENDING   INIT     WORD
-  //   ABBREV  | ABBREV    ABBREV   INIT     ABBREV
-  //   ENDING  | ABBREV    INIT     PRIMED   ENDING
-  //   PRIMED  | match!    INIT     PRIMED   PRIMED
-  char code = sentence_case_press_user(keycode, record, mods);
+  const char code = sentence_case_press_user(keycode, record, mods);
 #if defined SENTENCE_CASE_DEBUG
   dprintf("Sentence Case: code = '%c' (%d)\n", code, (int)code);
 #endif  // SENTENCE_CASE_DEBUG
+  uint8_t key_class;
   switch (code) {
     case '\0':  // Current key should be ignored.
       return true;
-
-    case 'a':  // Current key is a letter.
-      switch (sentence_state) {
-        case STATE_ABBREV:
-        case STATE_ENDING:
-          new_state = STATE_ABBREV;
-          break;
-
-        case STATE_PRIMED:
-          // This is the start of a sentence.
-          if (keycode != suppress_key) {
-            suppress_key = keycode;
-            set_oneshot_mods(MOD_BIT(KC_LSFT));  // Shift mod to capitalize.
-            new_state = STATE_WORD;
-          }
-          break;
-
-        default:
-          new_state = STATE_WORD;
-      }
+    case 'a':
+      key_class = CLASS_LETTER;
       break;
-
-    case '.':  // Current key is sentence-ending punctuation.
-      switch (sentence_state) {
-        case STATE_WORD:
-          new_state = STATE_ENDING;
-          break;
-
-        default:
-          new_state = STATE_ABBREV;
-      }
+    case '.':
+      key_class = CLASS_ENDING;
       break;
-
-    case ' ':  // Current key is a space.
-      if (sentence_state == STATE_PRIMED ||
-          (sentence_state == STATE_ENDING
-#if SENTENCE_CASE_BUFFER_SIZE > 1
-           && sentence_case_check_ending(key_buffer)
-#endif  // SENTENCE_CASE_BUFFER_SIZE > 1
-               )) {
-        new_state = STATE_PRIMED;
-        suppress_key = KC_NO;
-      }
+    case ' ':
+      key_class = CLASS_SPACE;
       break;
-
-    case '\'':  // Current key is a quote.
-      new_state = sentence_state;
+    case '\'':
+      key_class = CLASS_QUOTE;
       break;
+    default:
+      key_class = CLASS_SYMBOL;
   }
 
-    // Slide key_buffer and state_history buffers one element to the left.
-    // Optimization note: Using manual loops instead of memmove() here saved
-    // ~100 bytes on AVR.
-#if SENTENCE_CASE_BUFFER_SIZE > 1
-  for (int8_t i = 0; i < SENTENCE_CASE_BUFFER_SIZE - 1; ++i) {
-    key_buffer[i] = key_buffer[i + 1];
+  const uint8_t entry = pgm_read_byte(&transitions[sentence_state][key_class]);
+  uint8_t new_state = entry & STATE_MASK;
+
+  if (entry & ACTION_CAPITALIZE) {  // This is the start of a sentence.
+    if (keycode != suppress_key) {
+      suppress_key = keycode;
+      set_oneshot_mods(MOD_BIT(KC_LSFT));  // Shift mod to capitalize.
+    } else {
+      new_state = STATE_INIT;
+    }
   }
-#endif  // SENTENCE_CASE_BUFFER_SIZE > 1
-  for (int8_t i = 0; i < STATE_HISTORY_SIZE - 1; ++i) {
-    state_history[i] = state_history[i + 1];
+  if (entry & ACTION_UNSUPPRESS) {
+    suppress_key = KC_NO;
   }
 
+  // Advance the ring buffers.
+#ifdef OWN_KEY_BUFFER
+  if (++key_head >= SENTENCE_CASE_BUFFER_SIZE) {
+    key_head = 0;
+  }
+  set_key(keycode);
+#endif  // OWN_KEY_BUFFER
 #if SENTENCE_CASE_BUFFER_SIZE > 1
-  key_buffer[SENTENCE_CASE_BUFFER_SIZE - 1] = keycode;
-  if (new_state == STATE_ENDING && !sentence_case_check_ending(key_buffer)) {
+  if ((entry & ACTION_CHECK_ENDING) &&
+      !sentence_case_check_ending(get_key_buffer())) {
 #if defined SENTENCE_CASE_DEBUG
     dprintf("Not a real ending.\n");
 #endif  // SENTENCE_CASE_DEBUG
     new_state = STATE_INIT;
   }
 #endif  // SENTENCE_CASE_BUFFER_SIZE > 1
-  state_history[STATE_HISTORY_SIZE - 1] = sentence_state;
+  state_head = (state_head + 1) & (STATE_HISTORY_SIZE - 1);
+  state_history[state_head] = sentence_state;
 
   set_sentence_state(new_state);
   return true;
@@ -313,15 +399,50 @@ bool sentence_case_just_typed_P(const uint16_t* buffer, const uint16_t* pattern,
 #endif  // SENTENCE_CASE_BUFFER_SIZE > 1
 }
 
-__attribute__((weak)) bool sentence_case_check_ending(const uint16_t* buffer) {
-#if SENTENCE_CASE_BUFFER_SIZE >= 5
-  // Don't consider the abbreviations "vs." and "etc." to end the sentence.
-  if (SENTENCE_CASE_JUST_TYPED(KC_SPC, KC_V, KC_S, KC_DOT) ||
-      SENTENCE_CASE_JUST_TYPED(KC_SPC, KC_E, KC_T, KC_C, KC_DOT)) {
-    return false;  // Not a real sentence ending.
+#if SENTENCE_CASE_BUFFER_SIZE > 1
+/** Whether `keycode` may be part of an abbreviation. */
+static bool is_abbrev_key(uint16_t keycode) {
+  return (KC_A <= keycode && keycode <= KC_Z) || keycode == KC_QUOT;
+}
+#endif  // SENTENCE_CASE_BUFFER_SIZE > 1
+
+bool sentence_case_is_abbreviation(const uint16_t* buffer) {
+#if SENTENCE_CASE_BUFFER_SIZE > 1
+  const uint16_t* key = buffer + SENTENCE_CASE_BUFFER_SIZE - 1;
+  if (*key != KC_DOT) {
+    return false;
+  }
+
+  // Walk the trie from the key before the '.' backwards. An abbreviation
+  // matches if it ends at a node where the word ends, at a key that isn't
+  // part of a word or at the start of the buffer.
+  uint16_t offset = 0;
+  for (;;) {
+    const uint8_t header = pgm_read_byte(sentence_case_abbrev_data + offset);
+    if (key == buffer || !is_abbrev_key(*--key)) {
+      return header & 128;
+    }
+
+    const uint8_t num_children = header & 127;
+    const uint8_t* symbols = sentence_case_abbrev_data + offset + 1;
+    uint8_t i = 0;
+    while (i < num_children && pgm_read_byte(symbols + i) < *key) {
+      ++i;
+    }
+    if (i == num_children || pgm_read_byte(symbols + i) != *key) {
+      return false;
+    }
+    const uint8_t* link = symbols + num_children + 2 * i;
+    offset = pgm_read_byte(link) | pgm_read_byte(link + 1) << 8;
   }
-#endif  // SENTENCE_CASE_BUFFER_SIZE >= 5
-  return true;  // Real sentence ending; capitalize next letter.
+#else
+  return false;
+#endif  // SENTENCE_CASE_BUFFER_SIZE > 1
+}
+
+__attribute__((weak)) bool sentence_case_check_ending(const uint16_t* buffer) {
+  // Don't consider abbreviations like "vs." and "etc." to end the sentence.
+  return !sentence_case_is_abbreviation(buffer);
 }
 
 __attribute__((weak)) char sentence_case_press_user(uint16_t keycode,
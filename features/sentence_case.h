@@ -33,9 +33,11 @@
  *   "a... a"
  *   "a.a. a"
  *
- * Additionally by default, abbreviations "vs." and "etc." are exceptionally
- * detected as not real sentence endings. You can use the callback
- * `sentence_case_check_ending()` to define other exceptions.
+ * Additionally by default, abbreviations like "vs." and "etc." are
+ * exceptionally detected as not real sentence endings. The abbreviations are
+ * listed in sentence_case_dict.txt, from which make_sentence_case_data.py
+ * generates sentence_case_data.h. You can edit the list and regenerate, or use
+ * the callback `sentence_case_check_ending()` to define other exceptions.
  *
  * @note One-shot keys must be enabled.
  *
@@ -53,7 +55,8 @@ extern "C" {
 
 // The size of the keycode buffer for `sentence_case_check_ending()`. It must be
 // at least as large as the longest pattern checked. If less than 2, buffering
-// is disabled and the callback is not called.
+// is disabled and the callback is not called. With Key Context
+// (features/key_context.h), the keys are read from its shared buffer.
 #ifndef SENTENCE_CASE_BUFFER_SIZE
 #define SENTENCE_CASE_BUFFER_SIZE 8
 #endif  // SENTENCE_CASE_BUFFER_SIZE
@@ -105,15 +108,23 @@ void sentence_case_primed(bool primed);
  * of the last SENTENCE_CASE_BUFFER_SIZE keycodes. Returning true means it is a
  * real sentence ending; returning false means it is not.
  *
- * The default implementation checks for the abbreviations "vs." and "etc.":
+ * The default implementation checks for the abbreviations in
+ * sentence_case_dict.txt, like "vs." and "etc.":
  *
  *     bool sentence_case_check_ending(const uint16_t* buffer) {
- *       // Don't consider "vs." and "etc." to end the sentence.
- *       if (SENTENCE_CASE_JUST_TYPED(KC_SPC, KC_V, KC_S, KC_DOT) ||
- *           SENTENCE_CASE_JUST_TYPED(KC_SPC, KC_E, KC_T, KC_C, KC_DOT)) {
+ *       // Don't consider abbreviations like "vs." and "etc." to end the
+ *       // sentence.
+ *       return !sentence_case_is_abbreviation(buffer);
+ *     }
+ *
+ * To define other exceptions, you may combine the abbreviations with checks
+ * using `SENTENCE_CASE_JUST_TYPED()`, for example:
+ *
+ *     bool sentence_case_check_ending(const uint16_t* buffer) {
+ *       if (SENTENCE_CASE_JUST_TYPED(KC_SPC, KC_S, KC_T, KC_DOT)) {
  *         return false;  // Not a real sentence ending.
  *       }
- *       return true;  // Real sentence ending; capitalize next letter.
+ *       return !sentence_case_is_abbreviation(buffer);
  *     }
  *
  * @note This callback is used only if `SENTENCE_CASE_BUFFER_SIZE >= 2`.
@@ -124,6 +135,21 @@ void sentence_case_primed(bool primed);
  */
 bool sentence_case_check_ending(const uint16_t* buffer);
 
+/**
+ * Whether the keys in `buffer` end in an abbreviation that doesn't end the
+ * sentence, from the table generated from sentence_case_dict.txt.
+ *
+ * An abbreviation like "vs." matches when its keys were the last typed,
+ * preceded by a key that isn't a letter or quote, like a space. All
+ * abbreviations are matched in one pass over at most as many keys as the
+ * longest, SENTENCE_CASE_ABBREV_MAX_LENGTH. Set `SENTENCE_CASE_BUFFER_SIZE` to
+ * at least one more than that to match the longest ones exactly.
+ *
+ * @param buffer Buffer of the last `SENTENCE_CASE_BUFFER_SIZE` keycodes.
+ * @return whether the buffer ends in an abbreviation.
+ */
+bool sentence_case_is_abbreviation(const uint16_t* buffer);
+
 /**
  * Macro to be used in `sentence_case_check_ending()`.
  *
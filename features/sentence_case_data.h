@@ -0,0 +1,50 @@
+// Copyright 2026 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Generated code.
+
+// Sentence Case abbreviations (19 entries):
+//   al.
+//   approx.
+//   ca.
+//   cf.
+//   dept.
+//   dr.
+//   eq.
+//   eqs.
+//   est.
+//   etc.
+//   fig.
+//   figs.
+//   incl.
+//   mr.
+//   mrs.
+//   prof.
+//   resp.
+//   viz.
+//   vs.
+
+#define SENTENCE_CASE_ABBREV_MAX_LENGTH 7
+
+static const uint8_t sentence_case_abbrev_data[205] PROGMEM = {12, 4, 6, 9, 10,
+  15, 19, 20, 21, 22, 23, 27, 29, 37, 0, 42, 0, 51, 0, 68, 0, 77, 0, 94, 0, 107,
+  0, 112, 0, 121, 0, 154, 0, 175, 0, 196, 0, 1, 6, 41, 0, 128, 1, 23, 46, 0, 1,
+  8, 50, 0, 128, 2, 6, 18, 58, 0, 59, 0, 128, 1, 21, 63, 0, 1, 19, 67, 0, 128,
+  1, 12, 72, 0, 1, 9, 76, 0, 128, 2, 4, 6, 84, 0, 85, 0, 128, 1, 17, 89, 0, 1,
+  12, 93, 0, 128, 1, 22, 98, 0, 1, 8, 102, 0, 1, 21, 106, 0, 128, 1, 8, 111, 0,
+  128, 2, 7, 16, 119, 0, 120, 0, 128, 128, 4, 10, 20, 21, 25, 134, 0, 143, 0,
+  148, 0, 153, 0, 1, 12, 138, 0, 1, 9, 142, 0, 128, 1, 8, 147, 0, 128, 1, 16,
+  152, 0, 128, 128, 2, 19, 22, 161, 0, 170, 0, 1, 8, 165, 0, 1, 7, 169, 0, 128,
+  1, 8, 174, 0, 128, 1, 18, 179, 0, 1, 21, 183, 0, 1, 19, 187, 0, 1, 19, 191, 0,
+  1, 4, 195, 0, 128, 1, 12, 200, 0, 1, 25, 204, 0, 128};
@@ -22,6 +22,8 @@
 
 #include "socd_cleaner.h"
 
+#include <string.h>
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -68,7 +70,8 @@ bool process_socd_cleaner(uint16_t keycode, keyrecord_t* record,
 
       case SOCD_CLEANER_0_WINS:  // Key 0 wins.
       case SOCD_CLEANER_1_WINS:  // Key 1 wins.
-        if (opposing == (state->resolution - SOCD_CLEANER_0_WINS)) {
+      case SOCD_CLEANER_PRIORITY:  // Same as key 0 wins.
+        if (opposing == (state->resolution == SOCD_CLEANER_1_WINS)) {
           // The opposing key is the winner. The current key has no effect.
           return false;  // Skip default handling.
         } else {
@@ -80,3 +83,126 @@ bool process_socd_cleaner(uint16_t keycode, keyrecord_t* record,
   }
   return true;  // Continue default handling to press/release current key.
 }
+
+#if SOCD_CLEANER_GROUP_MAX_KEYS > 8
+#error "socd_cleaner: SOCD_CLEANER_GROUP_MAX_KEYS must be at most 8"
+#endif
+
+// Maximum number of groups, limited by the encoding of `lookup`.
+#define MAX_GROUPS 31
+#define NONE 0xff
+
+// Fills `state->lookup`, mapping a basic keycode to the group and index of the
+// key in it, as `(group << 3 | index) + 1`, or 0 if the keycode is in no group.
+static void index_groups(socd_cleaner_groups_t* state) {
+  memset(state->lookup, 0, sizeof(state->lookup));
+  // Groups beyond the limit are ignored.
+  const uint8_t num_groups =
+      (state->num_groups > MAX_GROUPS) ? MAX_GROUPS : state->num_groups;
+  for (uint8_t g = 0; g < num_groups; ++g) {
+    for (uint8_t i = 0; i < SOCD_CLEANER_GROUP_MAX_KEYS; ++i) {
+      const uint8_t keycode = state->groups[g].keys[i];
+      if (keycode != KC_NO) {
+        state->lookup[keycode] = (g << 3 | i) + 1;
+      }
+    }
+  }
+  state->indexed = true;
+}
+
+// Gets the index of the key to send, or NONE if no key should be sent.
+static uint8_t get_winner(const socd_cleaner_group_t* group) {
+  if (!group->num_held) {
+    return NONE;
+  }
+  switch (group->resolution) {
+    case SOCD_CLEANER_LAST:  // The latest held key wins.
+      return group->order[group->num_held - 1];
+
+    case SOCD_CLEANER_FIRST:  // The earliest held key wins.
+      return group->order[0];
+
+    case SOCD_CLEANER_NEUTRAL:  // A key is sent only while held alone.
+      return (group->num_held == 1) ? group->order[0] : NONE;
+
+    case SOCD_CLEANER_1_WINS:
+      if (group->held & 2) {
+        return 1;
+      }
+      // Fallthrough intended.
+    case SOCD_CLEANER_0_WINS:
+    case SOCD_CLEANER_PRIORITY:  // The held key listed first wins.
+      return __builtin_ctz(group->held);
+  }
+  return NONE;
+}
+
+bool process_socd_cleaner_groups(uint16_t keycode, keyrecord_t* record,
+                                 socd_cleaner_groups_t* state) {
+  if (!socd_cleaner_enabled || keycode > 0xff) {
+    return true;  // Quick return when disabled or on non-basic keycodes.
+  }
+  if (!state->indexed) {
+    index_groups(state);
+  }
+  const uint8_t entry = state->lookup[keycode];
+  if (!entry) {
+    return true;  // Quick return on keys that aren't in a group.
+  }
+  socd_cleaner_group_t* group = &state->groups[(entry - 1) >> 3];
+  const uint8_t i = (entry - 1) & 7;  // Index of the current key.
+  const uint8_t bit = 1 << i;
+  if (!record->event.pressed && !(group->held & bit)) {
+    return true;  // Release of a key pressed while disabled.
+  }
+
+  const uint8_t old_winner = get_winner(group);
+
+  // Track which keys are physically held and in what order. The current key is
+  // removed from the press order, then pushed on top if this is a press.
+  if (group->held & bit) {
+    uint8_t j = 0;
+    while (group->order[j] != i) {
+      ++j;
+    }
+    --group->num_held;
+    for (; j < group->num_held; ++j) {
+      group->order[j] = group->order[j + 1];
+    }
+    group->held &= ~bit;
+  }
+  if (record->event.pressed) {
+    group->order[group->num_held++] = i;
+    group->held |= bit;
+  }
+
+  if (!group->resolution) {
+    return true;  // Filtering is off for this group.
+  }
+
+  const uint8_t new_winner = get_winner(group);
+  bool changed = false;
+  // Update the keys in the report, except the current key, which is left to
+  // default handling.
+  if (old_winner != new_winner) {
+    if (old_winner != NONE && old_winner != i) {
+      del_key(group->keys[old_winner]);
+      changed = true;
+    }
+    if (new_winner != NONE && new_winner != i) {
+      add_key(group->keys[new_winner]);
+      changed = true;
+    }
+  }
+
+  // Continue default handling to press the current key if it wins, or to
+  // release it if it was sent. Otherwise the current key has no effect.
+  if (record->event.pressed ? (new_winner == i) : (old_winner == i)) {
+    return true;
+  }
+  if (changed) {
+    // Send updated report (normally, default handling would do this).
+    send_keyboard_report();
+  }
+  return false;  // Skip default handling.
+}
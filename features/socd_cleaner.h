@@ -50,6 +50,38 @@
  * (https://docs.qmk.fm/keycodes_basic).
  *
  *
+ * Groups of keys
+ * --------------
+ *
+ * A `socd_cleaner_group_t` generalizes the pair to a group of up to
+ * `SOCD_CLEANER_GROUP_MAX_KEYS` (default 8) mutually exclusive keys, of which
+ * at most one is sent at a time. The groups are collected in a
+ * `socd_cleaner_groups_t`, which is handled by one call that looks up the
+ * group of the key in constant time:
+ *
+ *     socd_cleaner_group_t socd_groups[] = {
+ *       {{KC_W, KC_S}, SOCD_CLEANER_LAST},
+ *       {{KC_A, KC_D}, SOCD_CLEANER_LAST},
+ *       {{KC_U, KC_I, KC_O, KC_J, KC_K, KC_L}, SOCD_CLEANER_FIRST},
+ *     };
+ *     socd_cleaner_groups_t socd = {socd_groups, ARRAY_SIZE(socd_groups)};
+ *
+ *     bool process_record_user(uint16_t keycode, keyrecord_t* record) {
+ *       if (!process_socd_cleaner_groups(keycode, record, &socd)) {
+ *         return false;
+ *       }
+ *       // Your macros...
+ *       return true;
+ *     }
+ *
+ * Within a `socd_cleaner_groups_t`, a keycode may belong to only one group,
+ * and there may be up to 31 groups. Its lookup table of 256 bytes is filled on
+ * the first call, so the keys of the groups shouldn't be changed after that,
+ * while the resolutions may be. To change the keys, set `.indexed = false` to
+ * index them again. Several `socd_cleaner_groups_t` instances, e.g. one per
+ * layer, each keep their own table.
+ *
+ *
  * Enabling / disabling
  * --------------------
  *
@@ -85,6 +117,18 @@
  *
  *  - SOCD_CLEANER_1_WINS: Key 1 always wins, the second key listed.
  *
+ *  - SOCD_CLEANER_FIRST: First input priority. The key held the longest wins.
+ *    When it is released, the key held the next longest is sent.
+ *
+ *  - SOCD_CLEANER_PRIORITY: Fixed priority. Of the held keys, the one listed
+ *    first wins. In a pair, this is the same as SOCD_CLEANER_0_WINS.
+ *
+ * In a group, SOCD_CLEANER_LAST sends the latest held key, and when it is
+ * released, the key pressed before it. SOCD_CLEANER_NEUTRAL sends a key only
+ * while it is the only one held. SOCD_CLEANER_0_WINS is the same as
+ * SOCD_CLEANER_PRIORITY, and SOCD_CLEANER_1_WINS is the same but with the
+ * first two keys swapped. SOCD_CLEANER_FIRST is supported only in groups.
+ *
  * If you don't know what to pick, SOCD_CLEANER_LAST is recommended. The
  * resolution strategy on a `socd_cleaner_t` may be changed at run time by
  * assigning to `.resolution`.
@@ -113,6 +157,10 @@ enum socd_cleaner_resolution {
   SOCD_CLEANER_0_WINS,
   // Key 1 always wins.
   SOCD_CLEANER_1_WINS,
+  // First input priority. Supported only in groups.
+  SOCD_CLEANER_FIRST,
+  // Of the held keys, the one listed first wins.
+  SOCD_CLEANER_PRIORITY,
   // Sentinel to count the number of resolution strategies.
   SOCD_CLEANER_NUM_RESOLUTIONS,
 };
@@ -123,6 +171,29 @@ typedef struct {
   bool held[2];  // Tracks which keys are physically held.
 } socd_cleaner_t;
 
+#ifndef SOCD_CLEANER_GROUP_MAX_KEYS
+#define SOCD_CLEANER_GROUP_MAX_KEYS 8
+#endif  // SOCD_CLEANER_GROUP_MAX_KEYS
+
+typedef struct {
+  // Basic keycodes of the mutually exclusive keys, padded with KC_NO.
+  uint8_t keys[SOCD_CLEANER_GROUP_MAX_KEYS];
+  uint8_t resolution;  // Resolution strategy.
+  uint8_t held;  // Bitmask of physically held keys, bit i for keys[i].
+  uint8_t num_held;  // Number of held keys.
+  // Indices of the held keys in press order, from first to last.
+  uint8_t order[SOCD_CLEANER_GROUP_MAX_KEYS];
+} socd_cleaner_group_t;
+
+/** A set of groups, with the lookup table that indexes their keys. */
+typedef struct {
+  socd_cleaner_group_t* groups;
+  uint8_t num_groups;
+  bool indexed;  // Whether `lookup` has been filled.
+  // Maps a basic keycode to `(group << 3 | index) + 1` of the key, or 0.
+  uint8_t lookup[256];
+} socd_cleaner_groups_t;
+
 /**
  * Handler function for SOCD cleaner.
  *
@@ -133,6 +204,16 @@ typedef struct {
 bool process_socd_cleaner(uint16_t keycode, keyrecord_t* record,
                           socd_cleaner_t* state);
 
+/**
+ * Handler function for SOCD cleaner with groups of keys.
+ *
+ * This function should be called from process_record_user(), once per
+ * `socd_cleaner_groups_t`. It returns true when the event should continue to
+ * default handling.
+ */
+bool process_socd_cleaner_groups(uint16_t keycode, keyrecord_t* record,
+                                 socd_cleaner_groups_t* state);
+
 /** Determines globally whether SOCD cleaner is enabled. */
 extern bool socd_cleaner_enabled;
 
@@ -0,0 +1,191 @@
+// Copyright 2026 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file typing_speed.c
+ * @brief Typing Speed implementation
+ */
+
+#include "typing_speed.h"
+
+#ifdef TYPING_SPEED_ENABLE
+
+#ifdef HANDEDNESS_ENABLE
+#include "handedness.h"
+#endif  // HANDEDNESS_ENABLE
+
+#ifndef TYPING_SPEED_TERM_RATIO
+#define TYPING_SPEED_TERM_RATIO 32
+#endif  // TYPING_SPEED_TERM_RATIO
+#ifndef TYPING_SPEED_MAX_SHRINK
+#define TYPING_SPEED_MAX_SHRINK 60
+#endif  // TYPING_SPEED_MAX_SHRINK
+#ifndef TYPING_SPEED_MAX_INTERVAL
+#define TYPING_SPEED_MAX_INTERVAL 500
+#endif  // TYPING_SPEED_MAX_INTERVAL
+#ifndef TYPING_SPEED_IDLE_TIMEOUT
+#define TYPING_SPEED_IDLE_TIMEOUT 1000
+#endif  // TYPING_SPEED_IDLE_TIMEOUT
+#ifndef TYPING_SPEED_REPORT_INTERVAL
+#define TYPING_SPEED_REPORT_INTERVAL 10000
+#endif  // TYPING_SPEED_REPORT_INTERVAL
+
+// Per-key averages are kept in units of 4 ms in a byte.
+#if TYPING_SPEED_MAX_INTERVAL < 4 || TYPING_SPEED_MAX_INTERVAL > 1000
+#error "typing_speed: TYPING_SPEED_MAX_INTERVAL must be between 4 and 1000"
+#endif
+
+enum {
+  HAND_ANY,
+  HAND_LEFT,
+  HAND_RIGHT,
+  NUM_HANDS,
+};
+
+// Averages per hand in units of 1/16 ms, and per key in units of 4 ms. Zero
+// means no data, which is treated as TYPING_SPEED_MAX_INTERVAL.
+static uint16_t hand_average[NUM_HANDS] = {0};
+static uint8_t key_average[MATRIX_ROWS][MATRIX_COLS] = {{0}};
+
+static bool started = false;
+static uint16_t last_press_time = 0;
+static bool updated = false;
+static uint32_t report_timer = 0;
+
+static bool in_matrix(keypos_t pos) {
+  return pos.row < MATRIX_ROWS && pos.col < MATRIX_COLS;
+}
+
+static uint8_t hand_index(keypos_t pos) {
+#ifdef HANDEDNESS_ENABLE
+  switch (handedness_get(pos)) {
+    case 'L':
+      return HAND_LEFT;
+    case 'R':
+      return HAND_RIGHT;
+  }
+#endif  // HANDEDNESS_ENABLE
+  return HAND_ANY;
+}
+
+// EWMA with weight 1/8 for the new sample, in 1/16 ms.
+static void update_hand(uint8_t hand, uint16_t interval) {
+  const uint16_t average = hand_average[hand];
+  hand_average[hand] =
+      average ? average - (average >> 3) + (interval << 1) : interval << 4;
+}
+
+// EWMA with weight 1/4 for the new sample, in 4 ms units. Keys are each
+// pressed less often than a hand, so they adapt faster.
+static void update_key(keypos_t pos, uint16_t interval) {
+  const uint8_t sample = interval >> 2;
+  const uint8_t average = key_average[pos.row][pos.col];
+  key_average[pos.row][pos.col] =
+      average ? average + ((int16_t)sample - average) / 4 : sample;
+}
+
+void typing_speed_record(keyrecord_t* record) {
+  if (!record->event.pressed || !IS_KEYEVENT(record->event)) {
+    return;
+  }
+
+  const uint16_t time = record->event.time;
+  uint16_t interval = TIMER_DIFF_16(time, last_press_time);
+  last_press_time = time;
+  if (!started || interval >= TYPING_SPEED_IDLE_TIMEOUT) {
+    // First press of a burst. Forget the hand averages, so that terms are
+    // relaxed until the new pace is seen.
+    started = true;
+    memset(hand_average, 0, sizeof(hand_average));
+    return;
+  }
+
+  if (interval > TYPING_SPEED_MAX_INTERVAL) {
+    interval = TYPING_SPEED_MAX_INTERVAL;
+  } else if (interval < 4) {
+    interval = 4;  // Keep the per-key average nonzero.
+  }
+
+  update_hand(HAND_ANY, interval);
+  const uint8_t hand = hand_index(record->event.key);
+  if (hand != HAND_ANY) {
+    update_hand(hand, interval);
+  }
+  if (in_matrix(record->event.key)) {
+    update_key(record->event.key, interval);
+  }
+  updated = true;
+}
+
+static uint16_t hand_interval(uint8_t hand) {
+  return hand_average[hand] ? (hand_average[hand] + 8) >> 4
+                            : TYPING_SPEED_MAX_INTERVAL;
+}
+
+uint16_t typing_speed_interval(void) { return hand_interval(HAND_ANY); }
+
+uint16_t typing_speed_key_interval(keypos_t pos) {
+  if (!in_matrix(pos) || !key_average[pos.row][pos.col]) {
+    return TYPING_SPEED_MAX_INTERVAL;
+  }
+  return key_average[pos.row][pos.col] << 2;
+}
+
+uint16_t typing_speed_hand_interval(keypos_t pos) {
+  return hand_interval(in_matrix(pos) ? hand_index(pos) : HAND_ANY);
+}
+
+uint16_t typing_speed_scale(uint16_t base, uint16_t interval) {
+  const uint16_t term = ((uint32_t)interval * TYPING_SPEED_TERM_RATIO) >> 4;
+  const uint16_t min_term =
+      base > TYPING_SPEED_MAX_SHRINK ? base - TYPING_SPEED_MAX_SHRINK : 0;
+  if (term < min_term) {
+    return min_term;
+  }
+  return term < base ? term : base;
+}
+
+uint16_t typing_speed_term(uint16_t base, keypos_t pos) {
+  const uint16_t key = typing_speed_key_interval(pos);
+  const uint16_t hand = typing_speed_hand_interval(pos);
+  return typing_speed_scale(base, key > hand ? key : hand);
+}
+
+void typing_speed_report(void) {
+  uprintf("typing_speed: avg ms between presses: all %u, left %u, right %u\n",
+          hand_interval(HAND_ANY), hand_interval(HAND_LEFT),
+          hand_interval(HAND_RIGHT));
+  for (uint8_t row = 0; row < MATRIX_ROWS; ++row) {
+    uprintf("typing_speed: row %2u:", row);
+    for (uint8_t col = 0; col < MATRIX_COLS; ++col) {
+      if (key_average[row][col]) {
+        uprintf(" %4u", key_average[row][col] << 2);
+      } else {
+        uprintf("    -");
+      }
+    }
+    uprintf("\n");
+  }
+}
+
+void typing_speed_task(void) {
+  if (debug_enable && updated &&
+      timer_elapsed32(report_timer) >= TYPING_SPEED_REPORT_INTERVAL) {
+    typing_speed_report();
+    updated = false;
+    report_timer = timer_read32();
+  }
+}
+
+#endif  // TYPING_SPEED_ENABLE
@@ -0,0 +1,138 @@
+// Copyright 2026 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file typing_speed.h
+ * @brief Typing Speed - adapt tap-hold terms to how fast you are typing
+ *
+ * Overview
+ * --------
+ *
+ * A fixed tapping term is a compromise: during a fast burst, a home row mod
+ * held for longer than the usual time between presses is likely meant as a
+ * hold, while in slow typing the same duration is still a tap. Typing Speed
+ * keeps exponentially weighted moving averages (EWMAs) of the time between key
+ * presses, per key and per hand, and scales terms by them:
+ *
+ *     term = clamp(ratio * interval, base - max_shrink, base)
+ *
+ * where `interval` is the slower of the key's and its hand's average. So terms
+ * shrink in fast bursts and relax back to `base` as typing slows. A pause of
+ * `TYPING_SPEED_IDLE_TIMEOUT` ms starts a new burst, forgetting the hand
+ * averages so that the first keys after it get the full term.
+ *
+ * Each press costs a few shifts and adds, with no floating point. The per-key
+ * averages take one byte per matrix position. Hands are taken from
+ * handedness.h when `HANDEDNESS_ENABLE` is defined; otherwise only the
+ * average over all keys is kept.
+ *
+ *
+ * Add it to your keymap
+ * ---------------------
+ *
+ * In rules.mk, set `TYPING_SPEED_ENABLE = yes`. Then in keymap.c, add
+ *
+ *     #include "features/typing_speed.h"
+ *
+ *     bool pre_process_record_user(uint16_t keycode, keyrecord_t* record) {
+ *       typing_speed_record(record);
+ *       return true;
+ *     }
+ *
+ *     uint16_t get_tapping_term(uint16_t keycode, keyrecord_t* record) {
+ *       return typing_speed_term(TAPPING_TERM, record->event.key);
+ *     }
+ *
+ *     void housekeeping_task_user(void) {
+ *       typing_speed_task();
+ *       // Other tasks...
+ *     }
+ *
+ * With Achordion's `ACHORDION_STREAK`, the streak timeout can shrink the same
+ * way:
+ *
+ *     uint16_t achordion_streak_chord_timeout(uint16_t tap_hold_keycode,
+ *                                             uint16_t next_keycode) {
+ *       return typing_speed_scale(200, typing_speed_interval());
+ *     }
+ *
+ * Events are recorded in pre_process_record_user(), which QMK calls before
+ * the tap-hold logic, so that presses are timed as they happen. With debugging
+ * on, the learned averages are printed to the console every
+ * `TYPING_SPEED_REPORT_INTERVAL` ms while typing, or call
+ * `typing_speed_report()`.
+ *
+ * Options, to be defined in config.h:
+ *
+ *  - `TYPING_SPEED_TERM_RATIO`: ratio of term to interval, in 16ths
+ *    (default 32, i.e. twice the interval).
+ *  - `TYPING_SPEED_MAX_SHRINK`: most ms by which a term is shortened
+ *    (default 60).
+ *  - `TYPING_SPEED_MAX_INTERVAL`: intervals are clamped to this many ms, the
+ *    pace at which terms are fully relaxed (default 500, at most 1000).
+ *  - `TYPING_SPEED_IDLE_TIMEOUT`: ms of no presses that ends a burst
+ *    (default 1000).
+ */
+
+#pragma once
+
+#include "quantum.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifdef TYPING_SPEED_ENABLE
+
+/** Updates the averages with a key event. Call from pre_process_record_user(). */
+void typing_speed_record(keyrecord_t* record);
+
+/** Average ms between presses over all keys. */
+uint16_t typing_speed_interval(void);
+
+/** Average ms between the previous press and a press of the key at `pos`. */
+uint16_t typing_speed_key_interval(keypos_t pos);
+
+/** Average ms between presses on the hand of the key at `pos`. */
+uint16_t typing_speed_hand_interval(keypos_t pos);
+
+/** Scales a term of `base` ms by `interval`, as described above. */
+uint16_t typing_speed_scale(uint16_t base, uint16_t interval);
+
+/** Returns the term for the key at `pos`, given its `base` term. */
+uint16_t typing_speed_term(uint16_t base, keypos_t pos);
+
+/** Periodically prints the averages. Call from housekeeping_task_user(). */
+void typing_speed_task(void);
+
+/** Prints the averages per hand and per key. */
+void typing_speed_report(void);
+
+#else
+
+static inline void typing_speed_record(keyrecord_t* record) {}
+static inline uint16_t typing_speed_scale(uint16_t base, uint16_t interval) {
+  return base;
+}
+static inline uint16_t typing_speed_term(uint16_t base, keypos_t pos) {
+  return base;
+}
+static inline void typing_speed_task(void) {}
+static inline void typing_speed_report(void) {}
+
+#endif  // TYPING_SPEED_ENABLE
+
+#ifdef __cplusplus
+}
+#endif
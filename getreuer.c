@@ -29,6 +29,21 @@
 #include "user_song_list.h"
 #endif
 
+#ifdef AUTOCORRECTION_ENABLE
+#include "features/autocorrection.h"
+#endif  // AUTOCORRECTION_ENABLE
+#ifdef HANDEDNESS_ENABLE
+#include "features/handedness.h"
+#endif  // HANDEDNESS_ENABLE
+#include "features/deadlines.h"
+#include "features/event_log.h"
+#include "features/handler_profiler.h"
+#include "features/key_context.h"
+#include "features/keycode_class.h"
+#include "features/latency_tracer.h"
+#include "features/output_queue.h"
+#include "features/typing_speed.h"
+
 enum layers {
   BASE,
   SYM,
@@ -51,6 +66,7 @@ enum custom_keycodes {
   RGBHRND,
   RGBDEF1,
   RGBDEF2,
+  LATDUMP,  // Prints the Latency Tracer histograms.
   // Macros invoked through the Magic key.
   M_DOCSTR,
   M_EQEQ,
@@ -167,7 +183,7 @@ const uint16_t PROGMEM keymaps[][MATRIX_ROWS][MATRIX_COLS] = {
 
   [EXT] = LAYOUT_LR(  // Mouse and extras.
     _______, _______, _______, _______, _______, _______,
-    _______, XXXXXXX, XXXXXXX, XXXXXXX, XXXXXXX, XXXXXXX,
+    _______, LATDUMP, XXXXXXX, XXXXXXX, XXXXXXX, XXXXXXX,
     OM_SLOW, KC_LALT, KC_LCTL, KC_LSFT, SELLINE, XXXXXXX,
     _______, KC_LGUI, C(KC_V), C(KC_A), C(KC_C), C(KC_X),
                                                  KC_DEL , MS_BTN1,
@@ -228,13 +244,15 @@ const custom_shift_key_t custom_shift_keys[] = {
 // Tap-hold configuration (https://docs.qmk.fm/tap_hold)
 ///////////////////////////////////////////////////////////////////////////////
 uint16_t get_tapping_term(uint16_t keycode, keyrecord_t* record) {
-  switch (keycode) {
-    case HRM_R:
-    case HRM_E:
-      return TAPPING_TERM - 45;
-    default:
-      return TAPPING_TERM;
-  }
+  const uint16_t term =
+      (keycode == HRM_R || keycode == HRM_E) ? TAPPING_TERM - 45 : TAPPING_TERM;
+#ifdef TYPING_SPEED_ENABLE
+  // Shorten the term by up to 60 ms more in fast typing, for keys that are
+  // pressed in quick succession, like rolls over the ring finger mods.
+  return typing_speed_term(term, record->event.key);
+#else
+  return term;
+#endif  // TYPING_SPEED_ENABLE
 }
 
 uint16_t get_quick_tap_term(uint16_t keycode, keyrecord_t* record) {
@@ -251,6 +269,15 @@ uint16_t get_quick_tap_term(uint16_t keycode, keyrecord_t* record) {
   }
 }
 
+#if defined(ACHORDION_STREAK) && defined(TYPING_SPEED_ENABLE)
+// For boards using Achordion, the streak timeout shrinks in fast typing like
+// the tapping term does.
+uint16_t achordion_streak_chord_timeout(uint16_t tap_hold_keycode,
+                                        uint16_t next_keycode) {
+  return typing_speed_scale(200, typing_speed_interval());
+}
+#endif  // defined(ACHORDION_STREAK) && defined(TYPING_SPEED_ENABLE)
+
 #ifdef CHORDAL_HOLD
 bool get_chordal_hold(uint16_t tap_hold_keycode, keyrecord_t* tap_hold_record,
                       uint16_t other_keycode, keyrecord_t* other_record) {
@@ -258,7 +285,11 @@ bool get_chordal_hold(uint16_t tap_hold_keycode, keyrecord_t* tap_hold_record,
     case NAV_BSP:
       return true;
   }
+#ifdef HANDEDNESS_ENABLE
+  return handedness_chordal_hold(tap_hold_record, other_record);
+#else
   return get_chordal_hold_default(tap_hold_record, other_record);
+#endif  // HANDEDNESS_ENABLE
 }
 #endif  // CHORDAL_HOLD
 
@@ -269,35 +300,49 @@ bool get_chordal_hold(uint16_t tap_hold_keycode, keyrecord_t* tap_hold_record,
 bool apply_autocorrect(uint8_t backspaces, const char* str, char* typo,
                        char* correct) {
   for (uint8_t i = 0; i < backspaces; ++i) {
-    tap_code(KC_BSPC);
+    output_queue_tap_code(KC_BSPC);
   }
-  send_string_with_delay_P(str, TAP_CODE_DELAY);
+  output_queue_send_string_P(str);
   return false;
 }
 #endif  // AUTOCORRECT_ENABLE
 
+#ifdef AUTOCORRECTION_LOADABLE
+void raw_hid_receive(uint8_t* data, uint8_t length) {
+  autocorrection_raw_hid_receive(data, length);
+}
+#endif  // AUTOCORRECTION_LOADABLE
+
+///////////////////////////////////////////////////////////////////////////////
+// Keycode classes, used by Caps Word, Sentence Case, and Achordion
+///////////////////////////////////////////////////////////////////////////////
+// clang-format off
+const uint8_t keycode_classes[256] PROGMEM = {
+    KEYCODE_CLASS_DEFAULTS,
+    // ! and ? end sentences, as do Shift . and Shift ,.
+    [KC_1] = KCC_WORD_BREAK | KCC_CAPS_WORD | KCC_SHIFTED_ENDING,
+    [KC_DOT] = KCC_WORD_BREAK | KCC_ENDING | KCC_SHIFTED_ENDING | KCC_STREAK,
+    [KC_COMM] = KCC_WORD_BREAK | KCC_SYMBOL | KCC_SHIFTED_ENDING | KCC_STREAK,
+    [KC_SLSH] = KCC_WORD_BREAK | KCC_SHIFTED_ENDING,
+    // _ and : continue Caps Word, but - and ; don't.
+    [KC_MINS] = KCC_WORD_BREAK | KCC_SYMBOL | KCC_SHIFTED_CAPS_WORD,
+    [KC_SCLN] = KCC_WORD_BREAK | KCC_SYMBOL | KCC_SHIFTED_CAPS_WORD,
+};
+// clang-format on
+
 ///////////////////////////////////////////////////////////////////////////////
 // Caps word (https://docs.qmk.fm/features/caps_word)
 ///////////////////////////////////////////////////////////////////////////////
 #ifdef CAPS_WORD_ENABLE
 bool caps_word_press_user(uint16_t keycode) {
-  switch (keycode) {
-    // Keycodes that continue Caps Word, with shift applied.
-    case KC_A ... KC_Z:
-      add_weak_mods(MOD_BIT_LSHIFT);  // Apply shift to the next key.
-      return true;
-
-    // Keycodes that continue Caps Word, without shifting.
-    case KC_1 ... KC_0:
-    case KC_BSPC:
-    case KC_DEL:
-    case KC_UNDS:
-    case KC_COLN:
-      return true;
-
-    default:
-      return false;  // Deactivate Caps Word.
+  const uint8_t c = get_keycode_class(keycode, 0);
+  if (c & KCC_LETTER) {
+    add_weak_mods(MOD_BIT_LSHIFT);  // Apply shift to the next key.
+    return true;
   }
+  // Digits, backspace, delete, _ and : continue Caps Word without shifting.
+  // Other keys deactivate Caps Word.
+  return (c & KCC_CAPS_WORD) != 0;
 }
 #endif  // CAPS_WORD_ENABLE
 
@@ -308,32 +353,17 @@ bool caps_word_press_user(uint16_t keycode) {
 char sentence_case_press_user(uint16_t keycode, keyrecord_t* record,
                               uint8_t mods) {
   if ((mods & ~(MOD_MASK_SHIFT | MOD_BIT_RALT)) == 0) {
-    const bool shifted = mods & MOD_MASK_SHIFT;
-    switch (keycode) {
-      case KC_A ... KC_Z:
-        return 'a';  // Letter key.
-
-      case KC_DOT:  // Both . and Shift . (?) punctuate sentence endings.
-      case KC_EXLM:
-      case KC_QUES:
-        return '.';
-
-      case KC_COMM:
-        return shifted ? '.' : '#';
-
-      case KC_2 ... KC_0:  // 2 3 4 5 6 7 8 9 0
-      case KC_AT ... KC_RPRN:  // @ # $ % ^ & * ( )
-      case KC_MINS ... KC_SCLN:  // - = [ ] backslash ;
-      case KC_UNDS ... KC_COLN:  // _ + { } | :
-      case KC_GRV:
-        return '#';  // Symbol key.
-
-      case KC_SPC:
-        return ' ';  // Space key.
-
-      case KC_QUOT:
-      case KC_DQUO:
-        return '\'';  // Quote key.
+    const uint8_t c = get_keycode_class(keycode, mods);
+    if (c & KCC_LETTER) {
+      return 'a';  // Letter key.
+    } else if (c & KCC_ENDING) {
+      return '.';  // . ! ? and Shift , punctuate sentence endings.
+    } else if (c & KCC_SYMBOL) {
+      return '#';  // Symbol key.
+    } else if (keycode == KC_SPC) {
+      return ' ';  // Space key.
+    } else if (keycode == KC_QUOT || keycode == KC_DQUO) {
+      return '\'';  // Quote key.
     }
   }
 
@@ -402,11 +432,14 @@ static struct {
   uint8_t val_end;
 } lighting = {0};
 
+static void lighting_task(void);
+
 static void lighting_set_val(uint8_t val) {
   lighting.val = val;
   lighting.val_end = val;
   if (lighting.val_start != lighting.val_end) {
     lighting.timer = timer_read32();
+    deadline_set_in(lighting_task, 0);
   }
 }
 
@@ -447,6 +480,7 @@ static void lighting_set_sleep_timer(void) {
     const uint32_t duration =
         (lighting.event_count <= 10) ? UINT32_C(5000) : UINT32_C(30000);
     lighting.timer = (timer_read32() + duration) | 1;
+    deadline_set_in(lighting_task, duration);
   }
 }
 
@@ -489,6 +523,12 @@ static void lighting_task(void) {
     }
   } else if (diff < UINT32_MAX / 2) {  // Sleep timeout expired; begin fading.
     lighting.val_end = 0;
+  } else {  // Woken before the sleep timeout, e.g. by the `| 1` above.
+    deadline_set_in(lighting_task, -diff);
+  }
+
+  if (lighting.val_start != lighting.val_end) {
+    deadline_set_in(lighting_task, 1);  // Continue the transition.
   }
 }
 #endif  // RGB_MATRIX_ENABLE
@@ -497,8 +537,6 @@ static void lighting_task(void) {
 // Debug logging
 ///////////////////////////////////////////////////////////////////////////////
 #if !defined(NO_DEBUG) && defined(COMMUNITY_MODULE_KEYCODE_STRING_ENABLE)
-#pragma message "dlog_record: enabled"
-
 KEYCODE_STRING_NAMES_USER(
     KEYCODE_STRING_NAME(ARROW), KEYCODE_STRING_NAME(UPDIR),
     KEYCODE_STRING_NAME(STDCC), KEYCODE_STRING_NAME(USRNAME),
@@ -507,7 +545,16 @@ KEYCODE_STRING_NAMES_USER(
     KEYCODE_STRING_NAME(SELLINE), KEYCODE_STRING_NAME(RGBBRI),
     KEYCODE_STRING_NAME(RGBNEXT), KEYCODE_STRING_NAME(RGBHUP),
     KEYCODE_STRING_NAME(RGBHRND), KEYCODE_STRING_NAME(RGBDEF1),
-    KEYCODE_STRING_NAME(RGBDEF2), );
+    KEYCODE_STRING_NAME(RGBDEF2), KEYCODE_STRING_NAME(LATDUMP), );
+#endif  // !defined(NO_DEBUG) && defined(COMMUNITY_MODULE_KEYCODE_STRING_ENABLE)
+
+#if !defined(NO_DEBUG) && defined(EVENT_LOG_ENABLE)
+// Events are logged in binary and decoded on the host with
+// tools/qmk_sim/event_log_decode; see features/event_log.h.
+#pragma message "dlog_record: event log"
+#define dlog_record(keycode, record) event_log_record(keycode, record)
+#elif !defined(NO_DEBUG) && defined(COMMUNITY_MODULE_KEYCODE_STRING_ENABLE)
+#pragma message "dlog_record: enabled"
 
 static void dlog_record(uint16_t keycode, keyrecord_t* record) {
   if (!debug_enable) {
@@ -529,7 +576,7 @@ static void dlog_record(uint16_t keycode, keyrecord_t* record) {
 #else
 #pragma message "dlog_record: disabled"
 #define dlog_record(keycode, record)
-#endif  // !defined(NO_DEBUG) && defined(COMMUNITY_MODULE_KEYCODE_STRING_ENABLE)
+#endif  // !defined(NO_DEBUG) && defined(EVENT_LOG_ENABLE)
 
 ///////////////////////////////////////////////////////////////////////////////
 // Status LEDs
@@ -557,6 +604,14 @@ void caps_word_set_user(bool active) { STATUS_LED_3(active); }
 ///////////////////////////////////////////////////////////////////////////////
 
 void keyboard_post_init_user(void) {
+  handler_profiler_init();
+#ifdef HANDEDNESS_ENABLE
+  handedness_init();
+#endif  // HANDEDNESS_ENABLE
+#ifdef AUTOCORRECTION_LOADABLE
+  autocorrection_init();
+#endif  // AUTOCORRECTION_LOADABLE
+
 #if RGB_MATRIX_ENABLE
   lighting_init();
 #endif  // RGB_MATRIX_ENABLE
@@ -572,17 +627,58 @@ void keyboard_post_init_user(void) {
 #endif  // defined(AUDIO_ENABLE) && defined(MUSHROOM_SOUND)
 }
 
+bool pre_process_record_user(uint16_t keycode, keyrecord_t* record) {
+  output_queue_pre_process(keycode);
+  latency_tracer_pre_process(keycode, record);
+  typing_speed_record(record);
+  return true;
+}
+
 bool process_record_user(uint16_t keycode, keyrecord_t* record) {
+  HANDLER_PROFILER_BEGIN();
+  latency_tracer_begin(keycode, record);
 #ifdef RGB_MATRIX_ENABLE
   lighting_activity_trigger();
 #endif  // RGB_MATRIX_ENABLE
   dlog_record(keycode, record);
+  // The handlers below are profiled separately.
+  HANDLER_PROFILER_END(PROFILE_PROCESS_RECORD_USER);
 
+  if (keycode == LATDUMP) {
+    if (record->event.pressed) {
+      latency_tracer_report();  // No-op unless LATENCY_TRACER_ENABLE.
+    }
+    return false;
+  }
+  PROFILE_HANDLER(PROFILE_KEY_CONTEXT, process_key_context(keycode, record));
+#ifdef AUTOCORRECTION_ENABLE
+  if (!PROFILE_HANDLER(PROFILE_AUTOCORRECTION,
+                       process_autocorrection(keycode, record))) {
+    return false;
+  }
+#endif  // AUTOCORRECTION_ENABLE
+  // Keys typed while macro output is pending are queued behind it.
+  if (!PROFILE_HANDLER(PROFILE_OUTPUT_QUEUE,
+                       process_output_queue(keycode, record))) {
+    return false;
+  }
   return true;
 }
 
+void post_process_record_user(uint16_t keycode, keyrecord_t* record) {
+  latency_tracer_end();
+}
+
 void housekeeping_task_user(void) {
+  handler_profiler_task();
+  latency_tracer_task();
+  output_queue_task();
+  typing_speed_task();
+  event_log_task();
+  deadline_task();
 #ifdef RGB_MATRIX_ENABLE
-  lighting_task();
+  if (deadline_polling()) {
+    lighting_task();
+  }
 #endif  // RGB_MATRIX_ENABLE
 }
@@ -0,0 +1,120 @@
+// Copyright 2026 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Generated code.
+
+// Autocorrection dictionary (41 entries):
+//   :guage   -> gauge
+//   :thier   -> their
+//   :ture    -> true
+//   aquire   -> acquire
+//   cauhgt   -> caught
+//   cheif    -> chief
+//   choosen  -> chosen
+//   contians -> contains
+//   cosnt    -> const
+//   dervied  -> derived
+//   dosen't  -> doesn't
+//   fales    -> false
+//   fasle    -> false
+//   fitler   -> filter
+//   flase    -> false
+//   foward   -> forward
+//   heigth   -> height
+//   inclued  -> include
+//   intput   -> input
+//   lenght   -> length
+//   libary   -> library
+//   looses:  -> loses
+//   looup    -> lookup
+//   ouptut   -> output
+//   ouput    -> output
+//   overide  -> override
+//   psuedo   -> pseudo
+//   recieve  -> receive
+//   relevent -> relevant
+//   retrun   -> return
+//   retun    -> return
+//   reuslt   -> result
+//   reutrn   -> return
+//   saftey   -> safety
+//   singed   -> signed
+//   stirng   -> string
+//   strign   -> string
+//   swithc   -> switch
+//   swtich   -> switch
+//   udpate   -> update
+//   widht    -> width
+
+#define AUTOCORRECTION_MIN_LENGTH 5  // ":ture"
+#define AUTOCORRECTION_MAX_LENGTH 8  // "contians"
+#define AUTOCORRECTION_NUM_STATES 203
+
+static const uint8_t autocorrection_data[1106] PROGMEM = {56, 0, 0, 0, 60, 0,
+  70, 0, 0, 0, 77, 0, 0, 0, 90, 0, 94, 0, 0, 0, 0, 0, 98, 0, 0, 0, 0, 0, 108, 0,
+  115, 0, 0, 0, 119, 0, 123, 0, 0, 0, 136, 0, 0, 0, 140, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 144, 0, 1, 16, 151, 0, 3, 0, 155, 0, 7, 160, 0, 14, 168, 0, 2, 4, 176, 0,
+  14, 180, 0, 4, 0, 185, 0, 8, 193, 0, 11, 198, 0, 14, 203, 0, 1, 4, 208, 0, 1,
+  13, 212, 0, 3, 4, 219, 0, 8, 223, 0, 14, 228, 0, 2, 20, 233, 0, 21, 238, 0, 1,
+  18, 242, 0, 1, 4, 247, 0, 4, 0, 4, 1, 8, 9, 1, 19, 14, 1, 22, 21, 1, 1, 3, 29,
+  1, 1, 8, 34, 1, 2, 6, 39, 1, 19, 43, 1, 1, 20, 50, 1, 65, 0, 20, 55, 1, 66, 7,
+  4, 60, 1, 14, 64, 1, 66, 14, 13, 69, 1, 18, 73, 1, 1, 17, 78, 1, 65, 14, 18,
+  83, 1, 66, 0, 11, 88, 1, 18, 93, 1, 65, 8, 19, 98, 1, 65, 11, 0, 102, 1, 65,
+  14, 22, 107, 1, 1, 8, 112, 1, 2, 2, 117, 1, 19, 122, 1, 1, 13, 126, 1, 65, 8,
+  1, 130, 1, 65, 14, 14, 134, 1, 65, 20, 15, 142, 1, 1, 4, 150, 1, 65, 18, 20,
+  154, 1, 4, 2, 159, 1, 11, 164, 1, 19, 169, 1, 20, 176, 1, 65, 0, 5, 184, 1,
+  65, 8, 13, 189, 1, 2, 8, 199, 1, 17, 204, 1, 66, 22, 8, 209, 1, 19, 217, 1,
+  65, 3, 15, 221, 1, 65, 8, 3, 226, 1, 1, 20, 231, 1, 2, 7, 236, 1, 20, 241, 1,
+  65, 20, 8, 246, 1, 65, 20, 7, 251, 1, 1, 8, 0, 2, 65, 14, 14, 8, 2, 1, 19, 13,
+  2, 65, 18, 13, 17, 2, 65, 17, 21, 21, 2, 65, 18, 4, 25, 2, 65, 11, 4, 29, 2,
+  65, 18, 11, 36, 2, 1, 11, 41, 2, 65, 0, 18, 46, 2, 65, 22, 0, 51, 2, 65, 8, 6,
+  56, 2, 65, 2, 11, 60, 2, 1, 15, 65, 2, 1, 6, 70, 2, 1, 0, 74, 2, 66, 14, 18,
+  79, 2, 20, 84, 2, 66, 15, 19, 89, 2, 20, 93, 2, 1, 17, 98, 2, 65, 20, 4, 103,
+  2, 65, 2, 8, 107, 2, 65, 11, 4, 112, 2, 2, 17, 119, 2, 20, 124, 2, 66, 20, 18,
+  129, 2, 19, 134, 2, 65, 5, 19, 138, 2, 3, 2, 117, 1, 6, 142, 2, 19, 122, 1,
+  65, 8, 17, 146, 2, 65, 17, 8, 151, 2, 66, 8, 3, 226, 1, 19, 156, 2, 1, 8, 160,
+  2, 65, 15, 0, 165, 2, 65, 3, 7, 170, 2, 65, 20, 0, 175, 2, 65, 7, 8, 180, 2,
+  65, 20, 17, 185, 2, 65, 8, 17, 190, 2, 65, 7, 6, 195, 2, 66, 8, 5, 199, 2, 6,
+  56, 2, 65, 14, 18, 204, 2, 1, 8, 209, 2, 1, 19, 214, 2, 1, 8, 219, 2, 1, 13,
+  224, 2, 2, 13, 126, 1, 18, 228, 2, 65, 11, 4, 232, 2, 65, 11, 4, 235, 2, 65,
+  18, 4, 242, 2, 65, 0, 17, 248, 2, 1, 19, 253, 2, 65, 11, 20, 1, 3, 65, 15, 20,
+  6, 3, 1, 7, 11, 3, 65, 0, 17, 16, 3, 65, 18, 4, 21, 3, 65, 20, 15, 25, 3, 1,
+  20, 30, 3, 65, 20, 19, 35, 3, 65, 17, 8, 41, 3, 1, 3, 46, 3, 65, 8, 4, 51, 3,
+  2, 13, 126, 1, 21, 55, 3, 65, 17, 20, 59, 3, 65, 20, 13, 64, 3, 65, 18, 11,
+  68, 3, 1, 17, 73, 3, 1, 4, 78, 3, 1, 4, 82, 3, 65, 17, 13, 86, 3, 65, 8, 6,
+  90, 3, 1, 7, 94, 3, 65, 8, 2, 99, 3, 65, 0, 19, 104, 3, 65, 7, 19, 108, 3, 65,
+  0, 6, 112, 3, 65, 8, 4, 116, 3, 65, 17, 4, 120, 3, 65, 17, 4, 125, 3, 1, 19,
+  133, 3, 130, 105, 101, 102, 0, 65, 18, 4, 138, 3, 65, 8, 0, 142, 3, 130, 110,
+  115, 116, 0, 65, 8, 4, 147, 3, 1, 26, 151, 3, 129, 115, 101, 0, 194, 244, 2,
+  2, 13, 126, 1, 17, 155, 3, 131, 97, 108, 115, 101, 0, 65, 17, 3, 161, 3, 1, 7,
+  168, 3, 65, 20, 4, 172, 3, 65, 20, 19, 176, 3, 65, 7, 19, 179, 3, 65, 17, 24,
+  183, 3, 1, 18, 189, 3, 129, 107, 117, 112, 0, 65, 20, 19, 194, 3, 130, 116,
+  112, 117, 116, 0, 65, 8, 3, 197, 3, 65, 3, 14, 202, 3, 1, 21, 208, 3, 1, 4,
+  212, 3, 65, 20, 13, 216, 3, 128, 114, 110, 0, 65, 11, 19, 219, 3, 65, 17, 13,
+  225, 3, 1, 24, 231, 3, 1, 3, 236, 3, 1, 6, 242, 3, 1, 13, 248, 3, 65, 7, 2,
+  252, 3, 65, 2, 7, 0, 4, 1, 4, 6, 4, 129, 116, 104, 0, 1, 4, 13, 4, 1, 17, 19,
+  4, 130, 114, 117, 101, 0, 132, 99, 113, 117, 105, 114, 101, 0, 130, 103, 104,
+  116, 0, 1, 13, 24, 4, 65, 0, 13, 29, 4, 1, 3, 33, 4, 1, 19, 39, 4, 131, 108,
+  116, 101, 114, 0, 131, 114, 119, 97, 114, 100, 0, 129, 104, 116, 0, 1, 3, 46,
+  4, 195, 37, 3, 129, 116, 104, 0, 130, 114, 97, 114, 121, 0, 65, 18, 27, 50, 4,
+  195, 36, 3, 65, 3, 4, 55, 4, 131, 101, 117, 100, 111, 0, 1, 4, 61, 4, 1, 13,
+  67, 4, 194, 227, 3, 131, 115, 117, 108, 116, 0, 131, 116, 117, 114, 110, 0,
+  130, 101, 116, 121, 0, 131, 103, 110, 101, 100, 0, 131, 114, 105, 110, 103, 0,
+  129, 110, 103, 0, 129, 99, 104, 0, 131, 105, 116, 99, 104, 0, 132, 112, 100,
+  97, 116, 101, 0, 131, 97, 117, 103, 101, 0, 130, 101, 105, 114, 0, 131, 115,
+  101, 110, 0, 1, 18, 71, 4, 131, 105, 118, 101, 100, 0, 132, 101, 115, 110, 39,
+  116, 0, 129, 100, 101, 0, 132, 115, 101, 115, 0, 130, 114, 105, 100, 101, 0,
+  131, 101, 105, 118, 101, 0, 1, 19, 77, 4, 131, 97, 105, 110, 115, 0, 130, 97,
+  110, 116, 0};
+
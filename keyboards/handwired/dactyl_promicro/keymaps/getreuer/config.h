@@ -16,6 +16,9 @@
 
 #include "config_getreuer.h"
 
+// A subset of the full dictionary, whose 1106-byte table fits in flash.
+#define AUTOCORRECTION_DATA_FILE "autocorrection_data_dactyl.h"
+
 #define USE_SERIAL
 #define MASTER_RIGHT
 
@@ -14,8 +14,13 @@
 
 BOOTLOADER = atmel-dfu
 
+# Core Autocorrect doesn't fit in flash. Userspace autocorrection does, with a
+# smaller dictionary; see config.h.
 AUTOCORRECT_ENABLE = no
+AUTOCORRECTION_ENABLE = yes
 COMMAND_ENABLE = no
+# Typing Speed's per-key averages take a byte of RAM per matrix position.
+TYPING_SPEED_ENABLE = no
 
 ROOT_DIR := $(dir $(realpath $(lastword $(MAKEFILE_LIST))))
 include ${ROOT_DIR}../../../../../rules.mk
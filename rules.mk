@@ -12,6 +12,8 @@
 # See the License for the specific language governing permissions and
 # limitations under the License.
 
+GETREUER_DIR := $(dir $(realpath $(lastword $(MAKEFILE_LIST))))
+
 COMBO_ENABLE = yes
 EXTRAKEY_ENABLE = yes
 LTO_ENABLE = yes
@@ -22,11 +24,84 @@ UCIS_ENABLE = no
 UNICODE_COMMON = yes
 
 AUTOCORRECT_ENABLE ?= yes
+AUTOCORRECTION_ENABLE ?= no
+AUTOCORRECTION_LOADABLE ?= no
 CAPS_WORD_ENABLE ?= yes
 CONSOLE_ENABLE ?= no
+DEADLINES_ENABLE ?= yes
+EVENT_LOG_ENABLE ?= no
 GRAVE_ESC_ENABLE ?= no
+HANDEDNESS_ENABLE ?= yes
+HANDLER_PROFILER_ENABLE ?= no
+KEY_CONTEXT_ENABLE ?= no
+KEYCODE_CLASS_ENABLE ?= yes
+LATENCY_TRACER_ENABLE ?= no
 LAYER_LOCK_ENABLE ?= yes
 NKRO_ENABLE ?= no
+OUTPUT_QUEUE_ENABLE ?= no
 SPACE_CADET_ENABLE ?= no
 TAP_DANCE_ENABLE ?= no
+TYPING_SPEED_ENABLE ?= no
+
+# Userspace autocorrection, an alternative to core Autocorrect. Enable at most
+# one of the two.
+ifeq ($(strip $(AUTOCORRECTION_ENABLE)), yes)
+  OPT_DEFS += -DAUTOCORRECTION_ENABLE
+  SRC += $(GETREUER_DIR)features/autocorrection.c
+  # Dictionaries may be uploaded over raw HID; see autocorrection.h.
+  ifeq ($(strip $(AUTOCORRECTION_LOADABLE)), yes)
+    OPT_DEFS += -DAUTOCORRECTION_LOADABLE
+    RAW_ENABLE = yes
+  endif
+endif
+
+ifeq ($(strip $(DEADLINES_ENABLE)), yes)
+  OPT_DEFS += -DDEADLINES_ENABLE
+  SRC += $(GETREUER_DIR)features/deadlines.c
+endif
+
+# Logs key events in binary while debugging; see features/event_log.h.
+ifeq ($(strip $(EVENT_LOG_ENABLE)), yes)
+  OPT_DEFS += -DEVENT_LOG_ENABLE
+  SRC += $(GETREUER_DIR)features/event_log.c
+endif
+
+ifeq ($(strip $(HANDEDNESS_ENABLE)), yes)
+  OPT_DEFS += -DHANDEDNESS_ENABLE
+  SRC += $(GETREUER_DIR)features/handedness.c
+endif
+
+# Handler Profiler needs the DWT cycle counter, so is for ChibiOS boards only.
+ifeq ($(strip $(HANDLER_PROFILER_ENABLE)), yes)
+  OPT_DEFS += -DHANDLER_PROFILER_ENABLE
+  SRC += $(GETREUER_DIR)features/handler_profiler.c
+endif
+
+# Shared history of typed keys for userspace autocorrection; see
+# features/key_context.h.
+ifeq ($(strip $(KEY_CONTEXT_ENABLE)), yes)
+  OPT_DEFS += -DKEY_CONTEXT_ENABLE
+  SRC += $(GETREUER_DIR)features/key_context.c
+endif
+
+# Table of keycode classes for autocorrection and Achordion; see
+# features/keycode_class.h.
+ifeq ($(strip $(KEYCODE_CLASS_ENABLE)), yes)
+  OPT_DEFS += -DKEYCODE_CLASS_ENABLE
+  SRC += $(GETREUER_DIR)features/keycode_class.c
+endif
+
+ifeq ($(strip $(LATENCY_TRACER_ENABLE)), yes)
+  OPT_DEFS += -DLATENCY_TRACER_ENABLE
+  SRC += $(GETREUER_DIR)features/latency_tracer.c
+endif
+
+ifeq ($(strip $(OUTPUT_QUEUE_ENABLE)), yes)
+  OPT_DEFS += -DOUTPUT_QUEUE_ENABLE
+  SRC += $(GETREUER_DIR)features/output_queue.c
+endif
 
+ifeq ($(strip $(TYPING_SPEED_ENABLE)), yes)
+  OPT_DEFS += -DTYPING_SPEED_ENABLE
+  SRC += $(GETREUER_DIR)features/typing_speed.c
+endif
@@ -0,0 +1,215 @@
+# Copyright 2026 Google LLC
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     https://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+"""Uploads an autocorrection dictionary to keyboards over raw HID.
+
+For boards built with `AUTOCORRECTION_LOADABLE = yes` (see
+features/autocorrection.h). The dictionary is compiled with
+features/make_autocorrection_data.py in the table format that the board's
+firmware reads, then sent in 32-byte packets. The board checks the table's
+checksum, saves it to EEPROM, and switches to it without a reboot. Run like
+
+$ python3 autocorrection_upload.py my_dict.txt
+
+to upload to every connected board, or select boards with `--vid` and `--pid`.
+Run with `--info` to print which table each board uses, or `--reset` to switch
+back to the table built into the firmware.
+
+Requires the hid package (pip install hid) and the hidapi library.
+"""
+
+import argparse
+import binascii
+import os.path
+import sys
+from typing import Any, Dict, Iterator, List
+
+sys.path.insert(0, os.path.join(os.path.dirname(os.path.abspath(__file__)),
+                                '..', 'features'))
+import make_autocorrection_data  # pylint: disable=g-import-not-at-top
+
+# QMK's raw HID interface.
+RAW_USAGE_PAGE = 0xff60
+RAW_USAGE = 0x61
+PACKET_SIZE = 32
+TIMEOUT_MS = 1000
+
+# Protocol constants, as in autocorrection.c.
+HID_ID = 0xac
+FORMAT_VERSION = 1
+FLAG_BITMAP_ROWS = 1
+FLAG_FAIL_LINKS = 2
+FLAG_WIDE_LINKS = 4
+CMD_INFO = 1
+CMD_BEGIN = 2
+CMD_DATA = 3
+CMD_COMMIT = 4
+CMD_RESET = 5
+DATA_CHUNK_SIZE = PACKET_SIZE - 5
+
+STATUS_NAMES = ('ok', 'bad command', 'bad header', 'bad range',
+                'bad checksum', 'bad table')
+
+
+def compile_table(dict_file: str, flags: int, words: List[str]) -> bytes:
+  """Compiles a dictionary to a table in the format given by `flags`."""
+  autocorrections = make_autocorrection_data.parse_file(dict_file)
+  automaton = make_autocorrection_data.make_automaton(autocorrections)
+  make_autocorrection_data.check_substrings(automaton)
+  word_set = set(make_autocorrection_data.CORRECT_WORDS)
+  for file_name in words:
+    word_set.update(make_autocorrection_data.read_words(file_name))
+  make_autocorrection_data.check_words(automaton, word_set)
+
+  table = make_autocorrection_data.serialize_automaton(
+      automaton, bool(flags & FLAG_BITMAP_ROWS), bool(flags & FLAG_FAIL_LINKS))
+  if (table['link_size'] > 2) != bool(flags & FLAG_WIDE_LINKS):
+    raise ValueError('Table link size differs from the firmware\'s.')
+  print(f'Compiled {len(autocorrections)} entries to {len(table["data"])} '
+        'bytes.')
+  return bytes(table['data'])
+
+
+def make_header(table: bytes, flags: int) -> bytes:
+  """Makes the 8-byte header that is stored before the table."""
+  crc = binascii.crc_hqx(table, 0xffff)  # CRC-16/CCITT-FALSE.
+  return (b'AC' + bytes((FORMAT_VERSION, flags)) +
+          len(table).to_bytes(2, 'little') + crc.to_bytes(2, 'little'))
+
+
+def make_packet(command: int, payload: bytes = b'') -> bytes:
+  packet = bytes((HID_ID, command)) + payload
+  return packet + bytes(PACKET_SIZE - len(packet))
+
+
+def upload_packets(table: bytes, flags: int) -> Iterator[bytes]:
+  """Generates the packets that upload `table`."""
+  yield make_packet(CMD_BEGIN, make_header(table, flags))
+  for offset in range(0, len(table), DATA_CHUNK_SIZE):
+    chunk = table[offset:offset + DATA_CHUNK_SIZE]
+    yield make_packet(CMD_DATA, offset.to_bytes(2, 'little') +
+                      bytes((len(chunk),)) + chunk)
+  yield make_packet(CMD_COMMIT)
+
+
+def parse_reply(command: int, reply: bytes) -> Dict[str, Any]:
+  """Parses the board's reply to a packet with `command`."""
+  if len(reply) < 12 or reply[0] != HID_ID or reply[1] != command:
+    raise IOError('Unexpected reply: ' + reply.hex())
+  return {
+      'status': reply[2],
+      'version': reply[3],
+      'flags': reply[4],
+      'capacity': int.from_bytes(reply[5:7], 'little'),
+      'loaded': bool(reply[7]),
+      'size': int.from_bytes(reply[8:10], 'little'),
+      'crc': int.from_bytes(reply[10:12], 'little'),
+  }
+
+
+class Board:
+  """A keyboard's raw HID interface."""
+
+  def __init__(self, device):
+    self.device = device
+
+  def transact(self, packet: bytes) -> Dict[str, Any]:
+    """Sends a packet and returns the parsed reply, raising on errors."""
+    self.device.write(b'\0' + packet)  # Prefixed with report ID 0.
+    reply = parse_reply(packet[1], self.device.read(PACKET_SIZE, TIMEOUT_MS))
+    if reply['status'] != 0:
+      status = reply['status']
+      name = (STATUS_NAMES[status] if status < len(STATUS_NAMES)
+              else str(status))
+      raise IOError(f'Board replied with error: {name}')
+    return reply
+
+  def info(self) -> Dict[str, Any]:
+    reply = self.transact(make_packet(CMD_INFO))
+    if reply['version'] != FORMAT_VERSION:
+      raise IOError(f'Board has table format version {reply["version"]}, '
+                    f'expected {FORMAT_VERSION}.')
+    return reply
+
+  def upload(self, table: bytes, flags: int) -> Dict[str, Any]:
+    for packet in upload_packets(table, flags):
+      reply = self.transact(packet)
+    return reply
+
+  def reset(self) -> Dict[str, Any]:
+    return self.transact(make_packet(CMD_RESET))
+
+
+def describe(reply: Dict[str, Any]) -> str:
+  if reply['loaded']:
+    return (f'uploaded table of {reply["size"]} bytes, checksum '
+            f'{reply["crc"]:04x} (room for {reply["capacity"]})')
+  return (f'built-in table of {reply["size"]} bytes '
+          f'(room for {reply["capacity"]} to upload)')
+
+
+def main(argv):
+  parser = argparse.ArgumentParser(
+      description='Uploads an autocorrection dictionary over raw HID.')
+  parser.add_argument('dict_file', nargs='?')
+  parser.add_argument('--vid', type=lambda s: int(s, 16), default=0,
+                      help='USB vendor ID in hex, e.g. 3297')
+  parser.add_argument('--pid', type=lambda s: int(s, 16), default=0,
+                      help='USB product ID in hex')
+  parser.add_argument('--words', action='append', default=[],
+                      help='word list file to check typos against')
+  parser.add_argument('--info', action='store_true',
+                      help='print the table each board uses')
+  parser.add_argument('--reset', action='store_true',
+                      help='switch back to the built-in table')
+  args = parser.parse_args(argv[1:])
+  if not (args.dict_file or args.info or args.reset):
+    parser.error('a dict_file, --info, or --reset is required')
+
+  import hid  # pylint: disable=g-import-not-at-top
+  boards = [d for d in hid.enumerate(args.vid, args.pid)
+            if d['usage_page'] == RAW_USAGE_PAGE and d['usage'] == RAW_USAGE]
+  if not boards:
+    print('No boards with raw HID found.')
+    return 1
+
+  tables = {}  # Compiled tables, by format flags.
+  failures = 0
+  for d in boards:
+    name = f'{d["product_string"]} ({d["vendor_id"]:04x}:{d["product_id"]:04x})'
+    device = hid.Device(path=d['path'])
+    try:
+      board = Board(device)
+      reply = board.info()
+      if args.reset:
+        reply = board.reset()
+      elif args.dict_file:
+        flags = reply['flags']
+        if flags not in tables:
+          tables[flags] = compile_table(args.dict_file, flags, args.words)
+        if len(tables[flags]) > reply['capacity']:
+          raise IOError(f'Table of {len(tables[flags])} bytes exceeds the '
+                        f'{reply["capacity"]} bytes of room.')
+        reply = board.upload(tables[flags], flags)
+      print(f'{name}: {describe(reply)}')
+    except IOError as e:
+      print(f'{name}: {e}')
+      failures += 1
+    finally:
+      device.close()
+  return 1 if failures else 0
+
+
+if __name__ == '__main__':
+  sys.exit(main(sys.argv))
@@ -0,0 +1,339 @@
+// Copyright 2026 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file autocorrect_bench.c
+ * @brief Streams text corpora through autocorrection.c.
+ *
+ * Usage:
+ *
+ *     autocorrect_bench [-w wordlist] [-n max_lines] corpus_file ...
+ *
+ * Each byte of the corpus is typed as a key press, mapped to a keycode as
+ * send_string() would, and passed to process_autocorrection(). Letters, digits
+ * and punctuation map to their keys, newline to KC_ENT, and other bytes
+ * (including non-ASCII) to KC_ESC, which clears the autocorrection state.
+ *
+ * The tool prints the host time per key, the number of automaton rows looked
+ * up per key, and the number of corrections fired. Then each distinct firing
+ * is listed with its count as
+ *
+ *     <count> <corpus word> -> <word as corrected>
+ *
+ * most frequent first. Given a word list with `-w` (one word per line, e.g.
+ * /usr/share/dict/words), firings inside words that are in the list are
+ * listed separately as false triggers. Otherwise, all firings are listed,
+ * which on a corpus of correctly spelled text are all false triggers. Output
+ * is limited to `max_lines` per list (default 50, 0 for no limit).
+ *
+ * Build with `make autocorrect_bench`, optionally with `DICT=path/to/dict.txt`
+ * and `DICT_FLAGS=--bitmap` to try another dictionary or format.
+ */
+
+#include <ctype.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "quantum.h"
+
+#define MAX_WORD 64
+
+// Stubs for the QMK functions that autocorrection.c calls.
+static uint8_t bench_mods = 0;
+static uint8_t backspaces = 0;
+static const char* correction = NULL;
+
+uint8_t get_mods(void) { return bench_mods; }
+uint8_t get_oneshot_mods(void) { return 0; }
+
+void tap_code_delay(uint8_t keycode, uint16_t delay) {
+  if (keycode == KC_BSPC) {
+    ++backspaces;
+  }
+}
+
+void send_string_with_delay(const char* str, uint8_t interval) {
+  correction = str;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// String hash table, used for the word list and to group firings.
+////////////////////////////////////////////////////////////////////////////////
+
+typedef struct {
+  char* key;
+  uint32_t count;
+} entry_t;
+
+typedef struct {
+  entry_t* entries;
+  size_t capacity;  // Power of 2.
+  size_t size;
+} table_t;
+
+static uint32_t hash_string(const char* s) {
+  uint32_t h = 2166136261u;  // FNV-1a.
+  for (; *s; ++s) {
+    h = (h ^ (uint8_t)*s) * 16777619u;
+  }
+  return h;
+}
+
+static entry_t* table_find(const table_t* table, const char* key) {
+  size_t i = hash_string(key) & (table->capacity - 1);
+  while (table->entries[i].key && strcmp(table->entries[i].key, key)) {
+    i = (i + 1) & (table->capacity - 1);
+  }
+  return &table->entries[i];
+}
+
+static void table_init(table_t* table) {
+  table->capacity = 1024;
+  table->size = 0;
+  table->entries = calloc(table->capacity, sizeof(entry_t));
+}
+
+static void table_add(table_t* table, const char* key) {
+  if (2 * (table->size + 1) > table->capacity) {
+    table_t bigger = {calloc(2 * table->capacity, sizeof(entry_t)),
+                      2 * table->capacity, table->size};
+    for (size_t i = 0; i < table->capacity; ++i) {
+      if (table->entries[i].key) {
+        *table_find(&bigger, table->entries[i].key) = table->entries[i];
+      }
+    }
+    free(table->entries);
+    *table = bigger;
+  }
+  entry_t* entry = table_find(table, key);
+  if (!entry->key) {
+    entry->key = strdup(key);
+    ++table->size;
+  }
+  ++entry->count;
+}
+
+static int compare_entries(const void* a, const void* b) {
+  const entry_t* x = a;
+  const entry_t* y = b;
+  if (x->count != y->count) {
+    return x->count < y->count ? 1 : -1;
+  }
+  return strcmp(x->key, y->key);
+}
+
+static void print_table(const char* title, table_t* table, long max_lines) {
+  size_t n = 0;
+  for (size_t i = 0; i < table->capacity; ++i) {
+    if (table->entries[i].key) {
+      table->entries[n++] = table->entries[i];
+    }
+  }
+  qsort(table->entries, n, sizeof(entry_t), compare_entries);
+  printf("\n%s (%zu distinct):\n", title, n);
+  for (size_t i = 0; i < n; ++i) {
+    if (max_lines > 0 && (long)i >= max_lines) {
+      printf("  ... and %zu more\n", n - i);
+      break;
+    }
+    printf("%8u %s\n", table->entries[i].count, table->entries[i].key);
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Corpus streaming.
+////////////////////////////////////////////////////////////////////////////////
+
+static uint8_t byte_keycode[256];
+static bool byte_shifted[256];
+
+static uint64_t num_keys = 0;
+static uint64_t num_fired = 0;
+static table_t wordlist;
+static table_t false_triggers;
+static table_t fixes;
+
+// The current corpus word, and the word as it would be after corrections.
+static char word[MAX_WORD + 1];
+static uint8_t word_len = 0;
+static char typed[MAX_WORD + 1];
+static uint8_t typed_len = 0;
+static bool fired_in_word = false;
+
+static bool is_word_char(uint8_t c) { return isalpha(c) || c == '\''; }
+
+static void init_byte_keycodes(void) {
+  for (int c = 0; c < 256; ++c) {
+    byte_keycode[c] = KC_ESC;
+    if (c < 128 && pgm_read_byte(&ascii_to_keycode_lut[c]) != KC_NO &&
+        c != '\b') {
+      byte_keycode[c] = pgm_read_byte(&ascii_to_keycode_lut[c]);
+      byte_shifted[c] =
+          (pgm_read_byte(&ascii_to_shift_lut[c / 8]) >> (c % 8)) & 1;
+    }
+  }
+}
+
+static void end_word(void) {
+  if (fired_in_word) {
+    char key[2 * MAX_WORD + 8];
+    snprintf(key, sizeof(key), "%s -> %s", word, typed);
+    for (char* p = word; *p; ++p) {
+      *p = tolower((uint8_t)*p);
+    }
+    const bool known = wordlist.size && table_find(&wordlist, word)->key;
+    table_add(known ? &false_triggers : &fixes, key);
+    fired_in_word = false;
+  }
+  word_len = typed_len = 0;
+  word[0] = typed[0] = '\0';
+}
+
+static void apply_correction(void) {
+  ++num_fired;
+  fired_in_word = true;
+  typed_len = backspaces < typed_len ? typed_len - backspaces : 0;
+  for (const char* p = correction; *p && typed_len < MAX_WORD; ++p) {
+    if (is_word_char(*p)) {
+      typed[typed_len++] = *p;
+    }
+  }
+  typed[typed_len] = '\0';
+  backspaces = 0;
+  correction = NULL;
+}
+
+static void stream(const uint8_t* text, size_t size) {
+  keyrecord_t record = {.event = {.pressed = true}};
+  for (size_t i = 0; i < size; ++i) {
+    const uint8_t c = text[i];
+    bench_mods = byte_shifted[c] ? MOD_BIT(KC_LSFT) : 0;
+    const bool typed_key = process_autocorrection(byte_keycode[c], &record);
+    if (correction) {
+      apply_correction();
+    }
+
+    if (!is_word_char(c)) {
+      if (word_len || fired_in_word) {
+        end_word();
+      }
+    } else if (word_len < MAX_WORD) {
+      word[word_len++] = c;
+      word[word_len] = '\0';
+      if (typed_key && typed_len < MAX_WORD) {
+        typed[typed_len++] = c;
+        typed[typed_len] = '\0';
+      }
+    }
+  }
+  num_keys += size;
+}
+
+static bool stream_file(const char* filename) {
+  FILE* fp = fopen(filename, "rb");
+  if (!fp) {
+    fprintf(stderr, "Error: failed to open \"%s\"\n", filename);
+    return false;
+  }
+  static uint8_t buffer[1 << 20];
+  size_t n;
+  while ((n = fread(buffer, 1, sizeof(buffer), fp)) > 0) {
+    stream(buffer, n);
+  }
+  fclose(fp);
+  end_word();
+  return true;
+}
+
+static bool load_wordlist(const char* filename) {
+  FILE* fp = fopen(filename, "r");
+  if (!fp) {
+    fprintf(stderr, "Error: failed to open \"%s\"\n", filename);
+    return false;
+  }
+  char line[256];
+  while (fgets(line, sizeof(line), fp)) {
+    char* p = line;
+    for (; *p && *p != '\n' && *p != '\r'; ++p) {
+      *p = tolower((uint8_t)*p);
+    }
+    *p = '\0';
+    if (*line) {
+      table_add(&wordlist, line);
+    }
+  }
+  fclose(fp);
+  return true;
+}
+
+int main(int argc, char** argv) {
+  const char* wordlist_file = NULL;
+  long max_lines = 50;
+  int first_corpus = argc;
+
+  for (int i = 1; i < argc; ++i) {
+    if (!strcmp(argv[i], "-w") && i + 1 < argc) {
+      wordlist_file = argv[++i];
+    } else if (!strcmp(argv[i], "-n") && i + 1 < argc) {
+      max_lines = strtol(argv[++i], NULL, 10);
+    } else if (argv[i][0] != '-') {
+      first_corpus = i;
+      break;
+    } else {
+      break;
+    }
+  }
+  if (first_corpus >= argc) {
+    fprintf(stderr,
+            "Usage: %s [-w wordlist] [-n max_lines] corpus_file ...\n",
+            argv[0]);
+    return 1;
+  }
+
+  table_init(&wordlist);
+  table_init(&false_triggers);
+  table_init(&fixes);
+  if (wordlist_file && !load_wordlist(wordlist_file)) {
+    return 1;
+  }
+  init_byte_keycodes();
+
+  struct timespec start, end;
+  clock_gettime(CLOCK_MONOTONIC, &start);
+  for (int i = first_corpus; i < argc; ++i) {
+    if (!stream_file(argv[i])) {
+      return 1;
+    }
+  }
+  clock_gettime(CLOCK_MONOTONIC, &end);
+  const double elapsed_s =
+      (end.tv_sec - start.tv_sec) + 1e-9 * (end.tv_nsec - start.tv_nsec);
+
+  const double keys = num_keys ? (double)num_keys : 1.0;
+  printf("Keys:        %llu in %.2f s\n", (unsigned long long)num_keys,
+         elapsed_s);
+  printf("Time:        %.1f ns/key\n", 1e9 * elapsed_s / keys);
+  printf("Rows:        %.3f visited/key\n",
+         autocorrection_rows_visited / keys);
+  printf("Corrections: %llu fired\n", (unsigned long long)num_fired);
+
+  if (wordlist.size) {
+    print_table("False triggers inside listed words", &false_triggers,
+                max_lines);
+    print_table("Corrections of unlisted words", &fixes, max_lines);
+  } else {
+    print_table("Corrections fired", &fixes, max_lines);
+  }
+  return 0;
+}
@@ -0,0 +1,31 @@
+// Copyright 2026 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Configuration for the host simulator, force-included into every translation
+// unit like QMK does with a keymap's config.h.
+
+#pragma once
+
+// Simulated split keyboard. Rows 0-4 are the left half and rows 5-9 the right.
+#define MATRIX_ROWS 10
+#define MATRIX_COLS 6
+#define SPLIT_KEYBOARD
+
+#include "config_getreuer.h"
+
+// Caps Word is toggled with CW_TOGG, as in QMK core.
+#define CAPS_WORD_TOGGLE_KEY
+
+// The simulator's report sender calls latency_tracer_report_sent().
+#define LATENCY_TRACER_REPORT_HOOK
@@ -0,0 +1,95 @@
+// Copyright 2026 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file event_log_decode.c
+ * @brief Decodes Event Log records from the console into text.
+ *
+ * Usage:
+ *
+ *     qmk console | event_log_decode
+ *     replay -d trace_file 2>&1 >/dev/null | event_log_decode
+ *
+ * Reads lines from stdin. Event Log record lines (see features/event_log.h)
+ * are printed as
+ *
+ *     <time ms> L<layer> (<row>,<col>) [tap|hold] press|release <keycode>
+ *
+ * with keycodes formatted by get_keycode_string_r(). This tool is linked with
+ * the keymap, so that custom keycodes are named as on the keyboard. Other
+ * lines are printed unchanged.
+ */
+
+#include <stdlib.h>
+
+#include "qmk_sim.h"
+
+/** Parses `num_digits` hex digits at `str`, or returns -1. */
+static long parse_hex(const char* str, int num_digits) {
+  char digits[5] = {0};
+  memcpy(digits, str, num_digits);
+  char* end;
+  const long value = strtol(digits, &end, 16);
+  return (end == digits + num_digits) ? value : -1;
+}
+
+/** Decodes a record line, returning false if it isn't one. */
+static bool decode_record(const char* line) {
+  const size_t prefix_len = sizeof(EVENT_LOG_PREFIX) - 1;
+  if (strncmp(line, EVENT_LOG_PREFIX, prefix_len) != 0) {
+    return false;
+  }
+  const char* hex = line + prefix_len;
+  const long time = parse_hex(hex, 4);
+  const long keycode = parse_hex(hex + 4, 4);
+  const long row = parse_hex(hex + 8, 2);
+  const long col = parse_hex(hex + 10, 2);
+  const long layer = parse_hex(hex + 12, 2);
+  const long flags = parse_hex(hex + 14, 2);
+  if (time < 0 || keycode < 0 || row < 0 || col < 0 || layer < 0 ||
+      flags < 0) {
+    return false;
+  }
+
+  if (flags & EVENT_LOG_DROPPED) {
+    printf("%5ld dropped %ld events\n", time, keycode);
+    return true;
+  }
+  printf("%5ld L%-2ld ", time, layer);
+  if (flags & EVENT_LOG_COMBO) {  // Combos don't have a position.
+    printf("combo   ");
+  } else {
+    printf("(%2ld,%2ld) ", row, col);
+  }
+  char keycode_string[32];
+  get_keycode_string_r((uint16_t)keycode, keycode_string,
+                       sizeof(keycode_string));
+  printf("%-4s %-7s %s\n",
+         (flags & EVENT_LOG_TAP_HOLD)
+             ? ((flags & EVENT_LOG_TAP) ? "tap" : "hold")
+             : "",
+         (flags & EVENT_LOG_PRESSED) ? "press" : "release",
+         keycode_string);
+  return true;
+}
+
+int main(void) {
+  char line[256];
+  while (fgets(line, sizeof(line), stdin)) {
+    if (!decode_record(line)) {
+      fputs(line, stdout);
+    }
+  }
+  return 0;
+}
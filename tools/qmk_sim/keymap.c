@@ -0,0 +1,195 @@
+// Copyright 2026 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file keymap.c
+ * @brief Keymap for the host simulator.
+ *
+ * Like the keymap.c files under keyboards/, this file includes getreuer.c and
+ * makes the definitions specific to the simulated keyboard, which uses the
+ * Voyager's layout. Additionally, it wires up the libraries under features/ in
+ * place of the QMK core features and community modules that a firmware build
+ * would provide.
+ */
+
+#include QMK_KEYBOARD_H
+
+#include "keyboards/zsa/voyager/keymaps/getreuer/layout.h"
+#include "getreuer.c"
+
+#ifdef CHORDAL_HOLD
+// Same as the Voyager's chordal_hold_layout.
+const char chordal_hold_layout[MATRIX_ROWS][MATRIX_COLS] PROGMEM =
+  LAYOUT_LR(
+  '*'    , '*'    , '*'    , '*'    , '*'    , '*'    ,
+  '*'    , 'L'    , 'L'    , 'L'    , 'L'    , 'L'    ,
+  '*'    , 'L'    , 'L'    , 'L'    , 'L'    , 'L'    ,
+  '*'    , 'L'    , 'L'    , 'L'    , 'L'    , 'L'    ,
+                                               'L'    , 'L'    ,
+
+                    '*'    , '*'    , '*'    , '*'    , '*'    , '*'    ,
+                    'R'    , 'R'    , 'R'    , 'R'    , 'R'    , '*'    ,
+                    'R'    , 'R'    , 'R'    , 'R'    , 'R'    , '*'    ,
+                    'R'    , 'R'    , 'R'    , 'R'    , 'R'    , '*'    ,
+           'R'    , 'R'
+);
+#endif  // CHORDAL_HOLD
+
+uint8_t keymap_layer_count(void) { return ARRAY_SIZE(keymaps); }
+
+// Keys bound only in the simulator, so that traces can reach features that the
+// keymap doesn't bind. They take XXXXXXX positions on the EXT layer.
+enum sim_keycodes {
+  REPWORD = QK_USER_MAX,      // Types the last word again.
+  REPLST3 = QK_USER_MAX - 1,  // Types the last 3 keys again.
+};
+
+uint16_t keymap_sim_keycode(uint8_t layer, keypos_t key) {
+  if (layer == EXT && key.row == 1) {
+    switch (key.col) {
+      case 3:
+        return REPLST3;
+      case 4:
+        return QK_REP;
+      case 5:
+        return REPWORD;
+    }
+  }
+  return KC_NO;
+}
+
+#ifdef COMMUNITY_MODULE_CUSTOM_SHIFT_KEYS_ENABLE
+uint8_t NUM_CUSTOM_SHIFT_KEYS = ARRAY_SIZE(custom_shift_keys);
+#endif  // COMMUNITY_MODULE_CUSTOM_SHIFT_KEYS_ENABLE
+
+#ifdef COMMUNITY_MODULE_SELECT_WORD_ENABLE
+uint16_t SELECT_WORD_KEYCODE = SELWORD;
+#endif  // COMMUNITY_MODULE_SELECT_WORD_ENABLE
+
+// SOCD cleaning of the arrow keys on the NAV layer.
+static socd_cleaner_group_t socd_groups[] = {
+    {{KC_LEFT, KC_RGHT}, SOCD_CLEANER_LAST},
+    {{KC_UP, KC_DOWN}, SOCD_CLEANER_LAST},
+};
+static socd_cleaner_groups_t socd = {socd_groups, ARRAY_SIZE(socd_groups)};
+
+bool process_record_modules(uint16_t keycode, keyrecord_t* record) {
+  if (!PROFILE_HANDLER(PROFILE_ACHORDION,
+                       process_achordion(keycode, record))) {
+    return false;
+  }
+  // Key Context goes before the features that read it.
+  process_key_context(keycode, record);
+#ifdef AUTOCORRECT_ENABLE
+  if (!PROFILE_HANDLER(PROFILE_AUTOCORRECTION,
+                       process_autocorrection(keycode, record))) {
+    return false;
+  }
+#endif  // AUTOCORRECT_ENABLE
+#ifdef COMMUNITY_MODULE_SENTENCE_CASE_ENABLE
+  if (!PROFILE_HANDLER(PROFILE_SENTENCE_CASE,
+                       process_sentence_case(keycode, record))) {
+    return false;
+  }
+#endif  // COMMUNITY_MODULE_SENTENCE_CASE_ENABLE
+#ifdef CAPS_WORD_ENABLE
+  if (!PROFILE_HANDLER(PROFILE_CAPS_WORD,
+                       process_caps_word(keycode, record))) {
+    return false;
+  }
+#endif  // CAPS_WORD_ENABLE
+#ifdef REPEAT_KEY_ENABLE
+  // Replay keys go first so that they aren't remembered in the history.
+  switch (keycode) {
+    case REPWORD:
+      if (record->event.pressed) {
+        repeat_key_replay_word();
+      }
+      return false;
+    case REPLST3:
+      if (record->event.pressed) {
+        repeat_key_replay(3);
+      }
+      return false;
+  }
+  if (!PROFILE_HANDLER(
+          PROFILE_REPEAT_KEY,
+          process_repeat_key_with_alt(keycode, record, QK_REP, QK_AREP))) {
+    return false;
+  }
+#endif  // REPEAT_KEY_ENABLE
+#ifdef COMMUNITY_MODULE_CUSTOM_SHIFT_KEYS_ENABLE
+  if (!PROFILE_HANDLER(PROFILE_CUSTOM_SHIFT_KEYS,
+                       process_custom_shift_keys(keycode, record))) {
+    return false;
+  }
+#endif  // COMMUNITY_MODULE_CUSTOM_SHIFT_KEYS_ENABLE
+#ifdef COMMUNITY_MODULE_SELECT_WORD_ENABLE
+  if (!PROFILE_HANDLER(PROFILE_SELECT_WORD,
+                       process_select_word(keycode, record))) {
+    return false;
+  }
+  switch (keycode) {
+    case SELWBAK:
+    case SELLINE:
+      if (record->event.pressed) {
+        select_word_register(keycode == SELWBAK ? 'B' : 'L');
+      } else {
+        select_word_unregister();
+      }
+      return false;
+  }
+#endif  // COMMUNITY_MODULE_SELECT_WORD_ENABLE
+#ifdef LAYER_LOCK_ENABLE
+  if (!PROFILE_HANDLER(PROFILE_LAYER_LOCK,
+                       process_layer_lock(keycode, record, QK_LLCK))) {
+    return false;
+  }
+#endif  // LAYER_LOCK_ENABLE
+#ifdef COMMUNITY_MODULE_ORBITAL_MOUSE_ENABLE
+  if (!PROFILE_HANDLER(PROFILE_ORBITAL_MOUSE,
+                       process_orbital_mouse(keycode, record))) {
+    return false;
+  }
+#endif  // COMMUNITY_MODULE_ORBITAL_MOUSE_ENABLE
+  if (!PROFILE_HANDLER(PROFILE_SOCD_CLEANER,
+                       process_socd_cleaner_groups(keycode, record, &socd))) {
+    return false;
+  }
+  return true;
+}
+
+void housekeeping_task_modules(void) {
+  // With Deadlines, these tasks are called when due from deadline_task() in
+  // getreuer.c's housekeeping_task_user(), unless the deadline list overflowed.
+  if (!deadline_polling()) {
+    return;
+  }
+  achordion_task();
+#ifdef CAPS_WORD_ENABLE
+  caps_word_task();
+#endif  // CAPS_WORD_ENABLE
+#ifdef COMMUNITY_MODULE_SENTENCE_CASE_ENABLE
+  sentence_case_task();
+#endif  // COMMUNITY_MODULE_SENTENCE_CASE_ENABLE
+#ifdef COMMUNITY_MODULE_SELECT_WORD_ENABLE
+  select_word_task();
+#endif  // COMMUNITY_MODULE_SELECT_WORD_ENABLE
+#ifdef LAYER_LOCK_ENABLE
+  layer_lock_task();
+#endif  // LAYER_LOCK_ENABLE
+#ifdef COMMUNITY_MODULE_ORBITAL_MOUSE_ENABLE
+  orbital_mouse_task();
+#endif  // COMMUNITY_MODULE_ORBITAL_MOUSE_ENABLE
+}
@@ -0,0 +1,811 @@
+// Copyright 2026 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file qmk_sim.c
+ * @brief Host simulator implementation.
+ *
+ * This file implements the QMK API declared in quantum.h: a virtual clock,
+ * report sending, mods and layers, a simplified tap-hold engine, basic keycode
+ * handling, send_string, and deferred execution.
+ *
+ * The tap-hold engine handles one undecided tap-hold key at a time. Events
+ * that occur while it is undecided are buffered and replayed once it settles.
+ * The key is settled as a tap when released within the tapping term, as a hold
+ * when the tapping term expires, as a hold under PERMISSIVE_HOLD when another
+ * key is pressed and released within, and as a tap under CHORDAL_HOLD when
+ * `get_chordal_hold()` rejects a press of another key.
+ */
+
+#include "qmk_sim.h"
+
+#ifndef SIM_WAITING_BUFFER_SIZE
+#define SIM_WAITING_BUFFER_SIZE 16
+#endif  // SIM_WAITING_BUFFER_SIZE
+
+#ifndef SIM_DEFERRED_EXEC_SLOTS
+#define SIM_DEFERRED_EXEC_SLOTS 8
+#endif  // SIM_DEFERRED_EXEC_SLOTS
+
+bool debug_enable = false;
+layer_state_t layer_state = 0;
+layer_state_t default_layer_state = 1;
+
+static uint32_t now = 0;
+static sim_report_callback_t report_callback = NULL;
+
+///////////////////////////////////////////////////////////////////////////////
+// Timer
+///////////////////////////////////////////////////////////////////////////////
+
+uint16_t timer_read(void) { return (uint16_t)now; }
+uint32_t timer_read32(void) { return now; }
+uint16_t timer_elapsed(uint16_t last) { return (uint16_t)now - last; }
+uint32_t timer_elapsed32(uint32_t last) { return now - last; }
+void wait_ms(uint32_t ms) { now += ms; }
+
+///////////////////////////////////////////////////////////////////////////////
+// Reports, mods, and keys
+///////////////////////////////////////////////////////////////////////////////
+
+static uint8_t real_mods = 0;
+static uint8_t weak_mods = 0;
+static uint8_t oneshot_mods = 0;
+static uint8_t report_keys[6] = {0};
+static sim_report_t last_keyboard_report = {0};
+static report_mouse_t mouse_report = {0};
+
+static void emit_report(sim_report_t* report) {
+  report->time = now;
+  latency_tracer_report_sent();
+  if (report_callback) {
+    report_callback(report);
+  }
+}
+
+void send_keyboard_report(void) {
+  sim_report_t report = {.type = SIM_REPORT_KEYBOARD};
+  report.mods = real_mods | weak_mods | oneshot_mods;
+  memcpy(report.keys, report_keys, sizeof(report.keys));
+
+  // Like QMK, one-shot mods apply to the first report with a key in it.
+  for (int i = 0; i < 6; ++i) {
+    if (report_keys[i]) {
+      oneshot_mods = 0;
+      break;
+    }
+  }
+
+  if (report.mods != last_keyboard_report.mods ||
+      memcmp(report.keys, last_keyboard_report.keys, sizeof(report.keys))) {
+    last_keyboard_report = report;
+    emit_report(&report);
+  }
+}
+
+void host_mouse_send(report_mouse_t* report) {
+  sim_report_t sim_report = {.type = SIM_REPORT_MOUSE, .mouse = *report};
+  emit_report(&sim_report);
+}
+
+uint8_t get_mods(void) { return real_mods; }
+void add_mods(uint8_t mods) { real_mods |= mods; }
+void del_mods(uint8_t mods) { real_mods &= ~mods; }
+void set_mods(uint8_t mods) { real_mods = mods; }
+void clear_mods(void) { real_mods = 0; }
+
+void register_mods(uint8_t mods) {
+  if (mods) {
+    add_mods(mods);
+    send_keyboard_report();
+  }
+}
+
+void unregister_mods(uint8_t mods) {
+  if (mods) {
+    del_mods(mods);
+    send_keyboard_report();
+  }
+}
+
+uint8_t get_weak_mods(void) { return weak_mods; }
+void add_weak_mods(uint8_t mods) { weak_mods |= mods; }
+void del_weak_mods(uint8_t mods) { weak_mods &= ~mods; }
+void set_weak_mods(uint8_t mods) { weak_mods = mods; }
+void clear_weak_mods(void) { weak_mods = 0; }
+
+void register_weak_mods(uint8_t mods) {
+  if (mods) {
+    add_weak_mods(mods);
+    send_keyboard_report();
+  }
+}
+
+void unregister_weak_mods(uint8_t mods) {
+  if (mods) {
+    del_weak_mods(mods);
+    send_keyboard_report();
+  }
+}
+
+uint8_t get_oneshot_mods(void) { return oneshot_mods; }
+void add_oneshot_mods(uint8_t mods) { oneshot_mods |= mods; }
+void del_oneshot_mods(uint8_t mods) { oneshot_mods &= ~mods; }
+void set_oneshot_mods(uint8_t mods) { oneshot_mods = mods; }
+void clear_oneshot_mods(void) { oneshot_mods = 0; }
+
+uint8_t mod_config(uint8_t mods) { return mods; }
+
+/** Converts 5-bit `MOD_` mods to the 8-bit format used in reports. */
+static uint8_t mods_5_to_8(uint8_t mods) {
+  return (mods & 0x10) ? (mods & 0x0f) << 4 : mods & 0x0f;
+}
+
+void add_key(uint8_t keycode) {
+  int empty = -1;
+  for (int i = 0; i < 6; ++i) {
+    if (report_keys[i] == keycode) {
+      return;
+    } else if (empty < 0 && !report_keys[i]) {
+      empty = i;
+    }
+  }
+  if (empty >= 0) {
+    report_keys[empty] = keycode;
+  }
+}
+
+void del_key(uint8_t keycode) {
+  for (int i = 0; i < 6; ++i) {
+    if (report_keys[i] == keycode) {
+      report_keys[i] = KC_NO;
+    }
+  }
+}
+
+static void mouse_button(uint8_t keycode, bool pressed) {
+  const uint8_t bit = 1 << (keycode - MS_BTN1);
+  if (pressed) {
+    mouse_report.buttons |= bit;
+  } else {
+    mouse_report.buttons &= ~bit;
+  }
+  host_mouse_send(&mouse_report);
+}
+
+void register_code(uint8_t keycode) {
+  if (keycode == KC_NO) {
+    return;
+  } else if (IS_MODIFIER_KEYCODE(keycode)) {
+    add_mods(MOD_BIT(keycode));
+  } else if (MS_BTN1 <= keycode && keycode <= MS_BTN8) {
+    mouse_button(keycode, true);
+    return;
+  } else if (keycode < KC_SYSTEM_POWER) {
+    add_key(keycode);
+  } else {
+    return;  // Consumer and system keys are not simulated.
+  }
+  send_keyboard_report();
+}
+
+void unregister_code(uint8_t keycode) {
+  if (keycode == KC_NO) {
+    return;
+  } else if (IS_MODIFIER_KEYCODE(keycode)) {
+    del_mods(MOD_BIT(keycode));
+  } else if (MS_BTN1 <= keycode && keycode <= MS_BTN8) {
+    mouse_button(keycode, false);
+    return;
+  } else if (keycode < KC_SYSTEM_POWER) {
+    del_key(keycode);
+  } else {
+    return;
+  }
+  send_keyboard_report();
+}
+
+void register_code16(uint16_t keycode) {
+  const uint8_t mods = mods_5_to_8(QK_MODS_GET_MODS(keycode));
+  if (IS_MODIFIER_KEYCODE(keycode) || keycode == KC_NO) {
+    register_mods(mods);
+  } else {
+    register_weak_mods(mods);
+  }
+  register_code(QK_MODS_GET_BASIC_KEYCODE(keycode));
+}
+
+void unregister_code16(uint16_t keycode) {
+  const uint8_t mods = mods_5_to_8(QK_MODS_GET_MODS(keycode));
+  unregister_code(QK_MODS_GET_BASIC_KEYCODE(keycode));
+  if (IS_MODIFIER_KEYCODE(keycode) || keycode == KC_NO) {
+    unregister_mods(mods);
+  } else {
+    unregister_weak_mods(mods);
+  }
+}
+
+void tap_code_delay(uint8_t keycode, uint16_t delay) {
+  register_code(keycode);
+  wait_ms(delay);
+  unregister_code(keycode);
+}
+
+void tap_code16_delay(uint16_t keycode, uint16_t delay) {
+  register_code16(keycode);
+  wait_ms(delay);
+  unregister_code16(keycode);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Send string
+///////////////////////////////////////////////////////////////////////////////
+
+void send_char(char ascii_code) {
+  const uint8_t c = (uint8_t)ascii_code;
+  if (c >= 128) {
+    return;
+  }
+  const uint8_t keycode = pgm_read_byte(&ascii_to_keycode_lut[c]);
+  const bool shifted =
+      (pgm_read_byte(&ascii_to_shift_lut[c / 8]) >> (c % 8)) & 1;
+  if (shifted) {
+    register_code(KC_LSFT);
+  }
+  tap_code(keycode);
+  if (shifted) {
+    unregister_code(KC_LSFT);
+  }
+}
+
+// As in QMK, each character or SS_TAP is tapped with TAP_CODE_DELAY, followed
+// by a pause of `interval` ms.
+void send_string_with_delay(const char* str, uint8_t interval) {
+  for (; *str; ++str) {
+    if (*str == SS_QMK_PREFIX) {
+      const char code = *++str;
+      if (!code) {
+        break;
+      } else if (code == SS_DELAY_CODE) {
+        uint32_t ms = 0;
+        for (; str[1] && str[1] != '|'; ++str) {
+          ms = 10 * ms + (str[1] - '0');
+        }
+        if (str[1]) {
+          ++str;
+        }
+        wait_ms(ms);
+        continue;
+      }
+      const uint8_t keycode = (uint8_t) * ++str;
+      if (!keycode) {
+        break;
+      }
+      switch (code) {
+        case SS_TAP_CODE:
+          tap_code(keycode);
+          break;
+        case SS_DOWN_CODE:
+          register_code(keycode);
+          break;
+        case SS_UP_CODE:
+          unregister_code(keycode);
+          break;
+      }
+    } else {
+      send_char(*str);
+    }
+    wait_ms(interval);
+  }
+}
+
+void send_string(const char* str) {
+  send_string_with_delay(str, TAP_CODE_DELAY);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Layers and keymap
+///////////////////////////////////////////////////////////////////////////////
+
+static uint8_t source_layers_cache[MATRIX_ROWS][MATRIX_COLS] = {{0}};
+
+__attribute__((weak)) layer_state_t layer_state_set_user(layer_state_t state) {
+  return state;
+}
+
+static void layer_state_set(layer_state_t state) {
+  layer_state = layer_state_set_user(state);
+}
+
+void layer_on(uint8_t layer) {
+  layer_state_set(layer_state | ((layer_state_t)1 << layer));
+}
+void layer_off(uint8_t layer) {
+  layer_state_set(layer_state & ~((layer_state_t)1 << layer));
+}
+void layer_move(uint8_t layer) {
+  layer_state_set((layer_state_t)1 << layer);
+}
+void layer_invert(uint8_t layer) {
+  layer_state_set(layer_state ^ ((layer_state_t)1 << layer));
+}
+void layer_and(layer_state_t state) { layer_state_set(layer_state & state); }
+void layer_or(layer_state_t state) { layer_state_set(layer_state | state); }
+void layer_clear(void) { layer_state_set(0); }
+
+uint8_t get_highest_layer(layer_state_t state) {
+  uint8_t layer = 0;
+  for (; state >>= 1; ++layer) {
+  }
+  return layer;
+}
+
+uint8_t read_source_layers_cache(keypos_t key) {
+  return source_layers_cache[key.row][key.col];
+}
+
+uint8_t get_oneshot_layer(void) { return 0; }
+void reset_oneshot_layer(void) {}
+
+uint16_t keymap_key_to_keycode(uint8_t layer, keypos_t key) {
+  if (layer >= keymap_layer_count() || key.row >= MATRIX_ROWS ||
+      key.col >= MATRIX_COLS) {
+    return KC_NO;
+  }
+  const uint16_t sim_keycode = keymap_sim_keycode(layer, key);
+  if (sim_keycode != KC_NO) {
+    return sim_keycode;
+  }
+  return pgm_read_word(&keymaps[layer][key.row][key.col]);
+}
+
+/** Finds the highest active layer where `key` is not transparent. */
+static uint8_t layer_switch_get_layer(keypos_t key) {
+  const layer_state_t state = layer_state | default_layer_state;
+  for (int layer = keymap_layer_count() - 1; layer > 0; --layer) {
+    if ((state & ((layer_state_t)1 << layer)) &&
+        keymap_key_to_keycode(layer, key) != KC_TRNS) {
+      return layer;
+    }
+  }
+  return 0;
+}
+
+static uint16_t get_event_keycode(keyevent_t event, bool update_cache) {
+  uint8_t layer;
+  if (!event.pressed) {
+    layer = read_source_layers_cache(event.key);
+  } else {
+    layer = layer_switch_get_layer(event.key);
+    if (update_cache) {
+      source_layers_cache[event.key.row][event.key.col] = layer;
+    }
+  }
+  return keymap_key_to_keycode(layer, event.key);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Processing
+///////////////////////////////////////////////////////////////////////////////
+
+__attribute__((weak)) bool pre_process_record_user(uint16_t keycode,
+                                                   keyrecord_t* record) {
+  return true;
+}
+__attribute__((weak)) bool process_record_user(uint16_t keycode,
+                                               keyrecord_t* record) {
+  return true;
+}
+__attribute__((weak)) void post_process_record_user(uint16_t keycode,
+                                                    keyrecord_t* record) {}
+__attribute__((weak)) void housekeeping_task_user(void) {}
+__attribute__((weak)) void keyboard_post_init_user(void) {}
+
+__attribute__((weak)) uint16_t get_tapping_term(uint16_t keycode,
+                                                keyrecord_t* record) {
+  return TAPPING_TERM;
+}
+
+__attribute__((weak)) uint16_t get_quick_tap_term(uint16_t keycode,
+                                                  keyrecord_t* record) {
+  return QUICK_TAP_TERM;
+}
+
+#ifdef CHORDAL_HOLD
+__attribute__((weak)) char chordal_hold_handedness(keypos_t key) {
+  return (char)pgm_read_byte(&chordal_hold_layout[key.row][key.col]);
+}
+
+bool get_chordal_hold_default(keyrecord_t* tap_hold_record,
+                              keyrecord_t* other_record) {
+  if (!IS_KEYEVENT(tap_hold_record->event) ||
+      !IS_KEYEVENT(other_record->event)) {
+    return true;  // Return true on combos or other non-key events.
+  }
+  const char tap_hold_hand =
+      chordal_hold_handedness(tap_hold_record->event.key);
+  if (tap_hold_hand == '*') {
+    return true;
+  }
+  const char other_hand = chordal_hold_handedness(other_record->event.key);
+  return other_hand == '*' || tap_hold_hand != other_hand;
+}
+
+__attribute__((weak)) bool get_chordal_hold(uint16_t tap_hold_keycode,
+                                            keyrecord_t* tap_hold_record,
+                                            uint16_t other_keycode,
+                                            keyrecord_t* other_record) {
+  return get_chordal_hold_default(tap_hold_record, other_record);
+}
+#endif  // CHORDAL_HOLD
+
+// One-shot mods held down and not yet interrupted by another key.
+static uint8_t oneshot_pending = 0;
+
+/** Default handling of a keycode once no handler has intercepted it. */
+static void process_keycode(uint16_t keycode, keyrecord_t* record) {
+  const bool pressed = record->event.pressed;
+
+  switch (keycode) {
+    case QK_MODS ... QK_MODS_MAX:
+      if (pressed) {
+        register_code16(keycode);
+      } else {
+        unregister_code16(keycode);
+      }
+      return;
+
+    case QK_MOD_TAP ... QK_MOD_TAP_MAX:
+      if (record->tap.count) {
+        keycode = QK_MOD_TAP_GET_TAP_KEYCODE(keycode);
+        break;
+      } else {
+        const uint8_t mods = mods_5_to_8(QK_MOD_TAP_GET_MODS(keycode));
+        if (pressed) {
+          register_mods(mods);
+        } else {
+          unregister_mods(mods);
+        }
+      }
+      return;
+
+    case QK_LAYER_TAP ... QK_LAYER_TAP_MAX:
+      if (record->tap.count) {
+        keycode = QK_LAYER_TAP_GET_TAP_KEYCODE(keycode);
+        break;
+      } else if (pressed) {
+        layer_on(QK_LAYER_TAP_GET_LAYER(keycode));
+      } else {
+        layer_off(QK_LAYER_TAP_GET_LAYER(keycode));
+      }
+      return;
+
+    case QK_LAYER_MOD ... QK_LAYER_MOD_MAX: {
+      const uint8_t mods = mods_5_to_8(QK_LAYER_MOD_GET_MODS(keycode));
+      if (pressed) {
+        layer_on(QK_LAYER_MOD_GET_LAYER(keycode));
+        register_mods(mods);
+      } else {
+        unregister_mods(mods);
+        layer_off(QK_LAYER_MOD_GET_LAYER(keycode));
+      }
+    }
+      return;
+
+    case QK_TO ... QK_TO_MAX:
+      if (pressed) {
+        layer_move(QK_TO_GET_LAYER(keycode));
+      }
+      return;
+
+    case QK_MOMENTARY ... QK_MOMENTARY_MAX:
+    case QK_ONE_SHOT_LAYER ... QK_ONE_SHOT_LAYER_MAX:
+    case QK_LAYER_TAP_TOGGLE ... QK_LAYER_TAP_TOGGLE_MAX: {
+      const uint8_t layer = keycode & 0x1f;
+      if (pressed) {
+        layer_on(layer);
+      } else {
+        layer_off(layer);
+      }
+    }
+      return;
+
+    case QK_TOGGLE_LAYER ... QK_TOGGLE_LAYER_MAX:
+      if (pressed) {
+        layer_invert(QK_TOGGLE_LAYER_GET_LAYER(keycode));
+      }
+      return;
+
+    case QK_ONE_SHOT_MOD ... QK_ONE_SHOT_MOD_MAX: {
+      const uint8_t mods = mods_5_to_8(QK_ONE_SHOT_MOD_GET_MODS(keycode));
+      if (pressed) {
+        register_mods(mods);
+        oneshot_pending |= mods;
+      } else {
+        unregister_mods(mods);
+        if (oneshot_pending & mods) {  // Tapped alone; arm the one-shot mods.
+          oneshot_pending &= ~mods;
+          add_oneshot_mods(mods);
+        }
+      }
+    }
+      return;
+  }
+
+  if (IS_QK_BASIC(keycode) && keycode != KC_TRNS) {
+    if (pressed) {
+      register_code(keycode);
+    } else {
+      unregister_code(keycode);
+    }
+  }
+}
+
+void process_record(keyrecord_t* record) {
+  uint16_t keycode = record->keycode;
+  if (!keycode) {
+    keycode = get_event_keycode(record->event, true);
+  }
+
+  if (record->event.pressed && !IS_QK_ONE_SHOT_MOD(keycode)) {
+    oneshot_pending = 0;
+  }
+
+  if (!process_record_modules(keycode, record) ||
+      !process_record_user(keycode, record)) {
+    return;
+  }
+
+  process_keycode(keycode, record);
+  post_process_record_user(keycode, record);
+}
+
+void process_action(keyrecord_t* record, action_t action) {
+  const uint8_t mods = mods_5_to_8((action.code >> 8) & 0x1f);
+  const uint8_t key = action.code & 0xff;
+  const bool pressed = record->event.pressed;
+
+  if ((action.code >> 12) == 2 && record->tap.count && key) {
+    if (pressed) {
+      register_code(key);
+    } else {
+      unregister_code(key);
+    }
+  } else if (pressed) {
+    register_mods(mods);
+  } else {
+    unregister_mods(mods);
+  }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Tap-hold engine
+///////////////////////////////////////////////////////////////////////////////
+
+static bool tapping_active = false;
+static keyrecord_t tapping_record;
+static uint16_t tapping_keycode;
+static keyrecord_t waiting_buffer[SIM_WAITING_BUFFER_SIZE];
+static uint8_t waiting_size = 0;
+// Tap count of each key's press, to be used again on release.
+static uint8_t tap_counts[MATRIX_ROWS][MATRIX_COLS] = {{0}};
+
+static void handle_event(keyrecord_t* record);
+
+static bool is_tap_hold_keycode(uint16_t keycode) {
+  return IS_QK_MOD_TAP(keycode) || IS_QK_LAYER_TAP(keycode);
+}
+
+static bool same_key(keypos_t a, keypos_t b) {
+  return a.row == b.row && a.col == b.col;
+}
+
+/** Settles the undecided tap-hold key, then replays buffered events. */
+static void settle_tapping(bool tap) {
+  tapping_active = false;
+  tapping_record.tap.count = tap ? 1 : 0;
+  tapping_record.tap.interrupted = waiting_size > 0;
+  tap_counts[tapping_record.event.key.row][tapping_record.event.key.col] =
+      tapping_record.tap.count;
+  process_record(&tapping_record);
+
+  keyrecord_t buffered[SIM_WAITING_BUFFER_SIZE];
+  const uint8_t size = waiting_size;
+  memcpy(buffered, waiting_buffer, size * sizeof(keyrecord_t));
+  waiting_size = 0;
+  for (uint8_t i = 0; i < size; ++i) {
+    handle_event(&buffered[i]);
+  }
+}
+
+static void handle_event(keyrecord_t* record) {
+  keyevent_t* event = &record->event;
+
+  if (tapping_active) {
+    if (!event->pressed && same_key(event->key, tapping_record.event.key)) {
+      settle_tapping(true);  // Released within the tapping term.
+      handle_event(record);
+      return;
+    }
+    if (waiting_size >= SIM_WAITING_BUFFER_SIZE) {
+      settle_tapping(false);
+      handle_event(record);
+      return;
+    }
+    waiting_buffer[waiting_size++] = *record;
+
+    if (event->pressed) {
+#ifdef CHORDAL_HOLD
+      const uint16_t other_keycode = get_event_keycode(*event, false);
+      if (!get_chordal_hold(tapping_keycode, &tapping_record, other_keycode,
+                            record)) {
+        settle_tapping(true);
+      }
+#endif  // CHORDAL_HOLD
+    } else {
+#ifdef PERMISSIVE_HOLD
+      for (uint8_t i = 0; i + 1 < waiting_size; ++i) {
+        if (waiting_buffer[i].event.pressed &&
+            same_key(waiting_buffer[i].event.key, event->key)) {
+          settle_tapping(false);  // Another key was tapped within.
+          return;
+        }
+      }
+#endif  // PERMISSIVE_HOLD
+    }
+    return;
+  }
+
+  if (event->pressed) {
+    const uint16_t keycode = get_event_keycode(*event, false);
+    if (is_tap_hold_keycode(keycode)) {
+      tapping_active = true;
+      tapping_record = *record;
+      tapping_keycode = keycode;
+      return;
+    }
+    tap_counts[event->key.row][event->key.col] = 0;
+  } else {
+    record->tap.count = tap_counts[event->key.row][event->key.col];
+  }
+  process_record(record);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Deferred execution
+///////////////////////////////////////////////////////////////////////////////
+
+static struct {
+  deferred_token token;
+  uint32_t trigger_time;
+  deferred_exec_callback callback;
+  void* cb_arg;
+} deferred[SIM_DEFERRED_EXEC_SLOTS] = {{0}};
+static deferred_token last_token = 0;
+
+deferred_token defer_exec(uint32_t delay_ms, deferred_exec_callback callback,
+                          void* cb_arg) {
+  if (!delay_ms || !callback) {
+    return INVALID_DEFERRED_TOKEN;
+  }
+  for (int i = 0; i < SIM_DEFERRED_EXEC_SLOTS; ++i) {
+    if (deferred[i].token == INVALID_DEFERRED_TOKEN) {
+      if (++last_token == INVALID_DEFERRED_TOKEN) {
+        ++last_token;
+      }
+      deferred[i].token = last_token;
+      deferred[i].trigger_time = now + delay_ms;
+      deferred[i].callback = callback;
+      deferred[i].cb_arg = cb_arg;
+      return last_token;
+    }
+  }
+  return INVALID_DEFERRED_TOKEN;
+}
+
+bool extend_deferred_exec(deferred_token token, uint32_t delay_ms) {
+  for (int i = 0; token && i < SIM_DEFERRED_EXEC_SLOTS; ++i) {
+    if (deferred[i].token == token) {
+      deferred[i].trigger_time = now + delay_ms;
+      return true;
+    }
+  }
+  return false;
+}
+
+bool cancel_deferred_exec(deferred_token token) {
+  for (int i = 0; token && i < SIM_DEFERRED_EXEC_SLOTS; ++i) {
+    if (deferred[i].token == token) {
+      deferred[i].token = INVALID_DEFERRED_TOKEN;
+      return true;
+    }
+  }
+  return false;
+}
+
+static void deferred_exec_task(void) {
+  for (int i = 0; i < SIM_DEFERRED_EXEC_SLOTS; ++i) {
+    if (deferred[i].token != INVALID_DEFERRED_TOKEN &&
+        timer_expired32(now, deferred[i].trigger_time)) {
+      const deferred_token token = deferred[i].token;
+      const uint32_t delay =
+          deferred[i].callback(deferred[i].trigger_time, deferred[i].cb_arg);
+      if (deferred[i].token != token) {
+        continue;  // The callback canceled itself.
+      } else if (delay) {
+        deferred[i].trigger_time += delay;
+      } else {
+        deferred[i].token = INVALID_DEFERRED_TOKEN;
+      }
+    }
+  }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Simulator API
+///////////////////////////////////////////////////////////////////////////////
+
+void sim_init(void) {
+  now = 0;
+  layer_state = 0;
+  default_layer_state = 1;
+  real_mods = weak_mods = oneshot_mods = oneshot_pending = 0;
+  memset(report_keys, 0, sizeof(report_keys));
+  memset(&last_keyboard_report, 0, sizeof(last_keyboard_report));
+  memset(&mouse_report, 0, sizeof(mouse_report));
+  memset(source_layers_cache, 0, sizeof(source_layers_cache));
+  memset(tap_counts, 0, sizeof(tap_counts));
+  memset(deferred, 0, sizeof(deferred));
+  tapping_active = false;
+  waiting_size = 0;
+  keyboard_post_init_user();
+}
+
+void sim_set_report_callback(sim_report_callback_t callback) {
+  report_callback = callback;
+}
+
+uint32_t sim_now(void) { return now; }
+
+/** Runs one iteration of the main loop at the current time. */
+static void sim_tick(void) {
+  if (tapping_active &&
+      timer_elapsed(tapping_record.event.time) >=
+          get_tapping_term(tapping_keycode, &tapping_record)) {
+    settle_tapping(false);
+  }
+  housekeeping_task_modules();
+  housekeeping_task_user();
+  deferred_exec_task();
+}
+
+void sim_run_until(uint32_t time) {
+  while ((int32_t)(time - now) > 0) {
+    ++now;
+    sim_tick();
+  }
+}
+
+void sim_key_event(uint8_t row, uint8_t col, bool pressed) {
+  keyrecord_t record = {
+      .event = MAKE_KEYEVENT(row, col, pressed),
+  };
+  record.event.time = (uint16_t)now;
+  // As in QMK, pre_process_record_user() sees each event before tap-hold.
+  if (!pre_process_record_user(get_event_keycode(record.event, true),
+                               &record)) {
+    return;
+  }
+  handle_event(&record);
+}
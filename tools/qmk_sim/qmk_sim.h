@@ -0,0 +1,79 @@
+// Copyright 2026 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file qmk_sim.h
+ * @brief Host simulator for replaying key events through the keymap.
+ *
+ * The simulator runs getreuer.c and the libraries under features/ on the host
+ * against a virtual millisecond clock. Matrix events are fed in with
+ * `sim_key_event()`, time is advanced with `sim_run_until()`, and each HID
+ * report that the keymap sends is passed to a callback along with the virtual
+ * time it was sent. Since the clock is virtual, replays are deterministic.
+ *
+ * Time advances in two ways. `sim_run_until()` steps the clock 1 ms at a time,
+ * running the tap-hold timeouts, housekeeping tasks, and deferred callbacks
+ * on each step like QMK's main loop. `wait_ms()` advances the clock without
+ * running anything, the same as a blocking wait stalls the firmware.
+ */
+
+#pragma once
+
+#include "quantum.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef enum {
+  SIM_REPORT_KEYBOARD,
+  SIM_REPORT_MOUSE,
+} sim_report_type_t;
+
+/** A HID report as sent by the keymap. */
+typedef struct {
+  /** Virtual time in ms when the report was sent. */
+  uint32_t time;
+  sim_report_type_t type;
+  /** Keyboard report: 8-bit modifiers and up to 6 keys, zero padded. */
+  uint8_t mods;
+  uint8_t keys[6];
+  /** Mouse report. */
+  report_mouse_t mouse;
+} sim_report_t;
+
+typedef void (*sim_report_callback_t)(const sim_report_t* report);
+
+/** Resets the simulator and runs `keyboard_post_init_user()`.
+ *
+ * @note Static state within getreuer.c and features/ is not reset. Traces
+ * should end with all keys released so that they can be replayed repeatedly.
+ */
+void sim_init(void);
+
+/** Sets the callback to be called for each sent report. */
+void sim_set_report_callback(sim_report_callback_t callback);
+
+/** Gets the current virtual time in ms. */
+uint32_t sim_now(void);
+
+/** Steps the main loop until the virtual time reaches `time`. */
+void sim_run_until(uint32_t time);
+
+/** Delivers a matrix key event at the current virtual time. */
+void sim_key_event(uint8_t row, uint8_t col, bool pressed);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,714 @@
+// Copyright 2026 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file quantum.h
+ * @brief Host-side stand-in for QMK's quantum.h.
+ *
+ * This header declares the subset of the QMK API that getreuer.c and the
+ * libraries under features/ use, so that they can be compiled and run on the
+ * host by the simulator in qmk_sim.c. Keycode values follow QMK's encoding, but
+ * only as far as needed to make the range checks and GET macros consistent.
+ *
+ * @note This is not a QMK port. Tap-hold decisions, one-shot keys, and report
+ * sending are approximations of QMK's behavior, good enough for replaying
+ * traces and comparing outputs before and after a change.
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+// Compiler and AVR compatibility
+///////////////////////////////////////////////////////////////////////////////
+#define PROGMEM
+#define PSTR(s) (s)
+#define pgm_read_byte(addr) (*(const uint8_t*)(addr))
+#define pgm_read_word(addr) (*(const uint16_t*)(addr))
+#define pgm_read_dword(addr) (*(const uint32_t*)(addr))
+#define memcpy_P memcpy
+#define strlen_P strlen
+
+#ifndef ARRAY_SIZE
+#define ARRAY_SIZE(a) (sizeof(a) / sizeof((a)[0]))
+#endif  // ARRAY_SIZE
+
+#ifndef TAP_CODE_DELAY
+#define TAP_CODE_DELAY 0
+#endif  // TAP_CODE_DELAY
+#ifndef TAP_HOLD_CAPS_DELAY
+#define TAP_HOLD_CAPS_DELAY 80
+#endif  // TAP_HOLD_CAPS_DELAY
+#ifndef TAPPING_TERM
+#define TAPPING_TERM 200
+#endif  // TAPPING_TERM
+#ifndef QUICK_TAP_TERM
+#define QUICK_TAP_TERM TAPPING_TERM
+#endif  // QUICK_TAP_TERM
+
+/** Index of the highest set bit, like QMK's util.h. */
+static inline uint8_t biton(uint8_t bits) {
+  uint8_t n = 0;
+  while (bits >>= 1) {
+    ++n;
+  }
+  return n;
+}
+
+static inline uint8_t biton32(uint32_t bits) {
+  uint8_t n = 0;
+  while (bits >>= 1) {
+    ++n;
+  }
+  return n;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Keycodes
+///////////////////////////////////////////////////////////////////////////////
+// clang-format off
+enum qk_keycode_ranges {
+  QK_BASIC                = 0x0000,
+  QK_BASIC_MAX            = 0x00FF,
+  QK_MODS                 = 0x0100,
+  QK_MODS_MAX             = 0x1FFF,
+  QK_MOD_TAP              = 0x2000,
+  QK_MOD_TAP_MAX          = 0x3FFF,
+  QK_LAYER_TAP            = 0x4000,
+  QK_LAYER_TAP_MAX        = 0x4FFF,
+  QK_LAYER_MOD            = 0x5000,
+  QK_LAYER_MOD_MAX        = 0x51FF,
+  QK_TO                   = 0x5200,
+  QK_TO_MAX               = 0x521F,
+  QK_MOMENTARY            = 0x5220,
+  QK_MOMENTARY_MAX        = 0x523F,
+  QK_DEF_LAYER            = 0x5240,
+  QK_DEF_LAYER_MAX        = 0x525F,
+  QK_TOGGLE_LAYER         = 0x5260,
+  QK_TOGGLE_LAYER_MAX     = 0x527F,
+  QK_ONE_SHOT_LAYER       = 0x5280,
+  QK_ONE_SHOT_LAYER_MAX   = 0x529F,
+  QK_ONE_SHOT_MOD         = 0x52A0,
+  QK_ONE_SHOT_MOD_MAX     = 0x52BF,
+  QK_LAYER_TAP_TOGGLE     = 0x52C0,
+  QK_LAYER_TAP_TOGGLE_MAX = 0x52DF,
+  QK_PERSISTENT_DEF_LAYER = 0x52E0,
+  QK_PERSISTENT_DEF_LAYER_MAX = 0x52FF,
+  QK_SWAP_HANDS           = 0x5600,
+  QK_SWAP_HANDS_MAX       = 0x56FF,
+  QK_TAP_DANCE            = 0x5700,
+  QK_TAP_DANCE_MAX        = 0x57FF,
+  QK_QUANTUM              = 0x7C00,
+  QK_QUANTUM_MAX          = 0x7DFF,
+  QK_KB                   = 0x7E00,
+  QK_KB_MAX               = 0x7E3F,
+  QK_USER                 = 0x7E40,
+  QK_USER_MAX             = 0x7FFF,
+  QK_UNICODE              = 0x8000,
+  QK_UNICODE_MAX          = 0xFFFF,
+};
+
+enum qk_keycode_defines {
+  KC_NO = 0x00, KC_TRANSPARENT = 0x01,
+  KC_A = 0x04, KC_B, KC_C, KC_D, KC_E, KC_F, KC_G, KC_H, KC_I, KC_J, KC_K,
+  KC_L, KC_M, KC_N, KC_O, KC_P, KC_Q, KC_R, KC_S, KC_T, KC_U, KC_V, KC_W,
+  KC_X, KC_Y, KC_Z,
+  KC_1, KC_2, KC_3, KC_4, KC_5, KC_6, KC_7, KC_8, KC_9, KC_0,
+  KC_ENTER, KC_ESCAPE, KC_BACKSPACE, KC_TAB, KC_SPACE, KC_MINUS, KC_EQUAL,
+  KC_LEFT_BRACKET, KC_RIGHT_BRACKET, KC_BACKSLASH, KC_NONUS_HASH,
+  KC_SEMICOLON, KC_QUOTE, KC_GRAVE, KC_COMMA, KC_DOT, KC_SLASH, KC_CAPS_LOCK,
+  KC_F1, KC_F2, KC_F3, KC_F4, KC_F5, KC_F6, KC_F7, KC_F8, KC_F9, KC_F10,
+  KC_F11, KC_F12,
+  KC_PRINT_SCREEN, KC_SCROLL_LOCK, KC_PAUSE, KC_INSERT, KC_HOME, KC_PAGE_UP,
+  KC_DELETE, KC_END, KC_PAGE_DOWN, KC_RIGHT, KC_LEFT, KC_DOWN, KC_UP,
+  KC_NUM_LOCK, KC_KP_SLASH, KC_KP_ASTERISK, KC_KP_MINUS, KC_KP_PLUS,
+  KC_KP_ENTER, KC_KP_1, KC_KP_2, KC_KP_3, KC_KP_4, KC_KP_5, KC_KP_6, KC_KP_7,
+  KC_KP_8, KC_KP_9, KC_KP_0, KC_KP_DOT, KC_NONUS_BACKSLASH, KC_APPLICATION,
+  KC_KB_POWER, KC_KP_EQUAL,
+  KC_F13, KC_F14, KC_F15, KC_F16, KC_F17, KC_F18, KC_F19, KC_F20, KC_F21,
+  KC_F22, KC_F23, KC_F24,
+  KC_SYSTEM_POWER = 0xA5, KC_SYSTEM_SLEEP, KC_SYSTEM_WAKE, KC_AUDIO_MUTE,
+  KC_AUDIO_VOL_UP, KC_AUDIO_VOL_DOWN, KC_MEDIA_NEXT_TRACK,
+  KC_MEDIA_PREV_TRACK, KC_MEDIA_STOP, KC_MEDIA_PLAY_PAUSE, KC_MEDIA_SELECT,
+  KC_MEDIA_EJECT, KC_MAIL, KC_CALCULATOR, KC_MY_COMPUTER, KC_WWW_SEARCH,
+  KC_WWW_HOME, KC_WWW_BACK, KC_WWW_FORWARD, KC_WWW_STOP, KC_WWW_REFRESH,
+  KC_WWW_FAVORITES, KC_MEDIA_FAST_FORWARD, KC_MEDIA_REWIND, KC_BRIGHTNESS_UP,
+  KC_BRIGHTNESS_DOWN,
+  MS_UP = 0xCD, MS_DOWN, MS_LEFT, MS_RGHT,
+  MS_BTN1, MS_BTN2, MS_BTN3, MS_BTN4, MS_BTN5, MS_BTN6, MS_BTN7, MS_BTN8,
+  MS_WHLU, MS_WHLD, MS_WHLL, MS_WHLR, MS_ACL0, MS_ACL1, MS_ACL2,
+  KC_LEFT_CTRL = 0xE0, KC_LEFT_SHIFT, KC_LEFT_ALT, KC_LEFT_GUI,
+  KC_RIGHT_CTRL, KC_RIGHT_SHIFT, KC_RIGHT_ALT, KC_RIGHT_GUI,
+
+  QK_BOOTLOADER = 0x7C00,
+  QK_REBOOT = 0x7C01,
+  QK_DEBUG_TOGGLE = 0x7C02,
+  QK_CLEAR_EEPROM = 0x7C03,
+  QK_LEADER = 0x7C58,
+  QK_GRAVE_ESCAPE = 0x7C16,
+  QK_CAPS_WORD_TOGGLE = 0x7C73,
+  QK_REPEAT_KEY = 0x7C79,
+  QK_ALT_REPEAT_KEY = 0x7C7A,
+  QK_LAYER_LOCK = 0x7C7B,
+  QK_KB_0 = QK_KB,
+  QK_USER_0 = QK_USER,
+  SAFE_RANGE = QK_USER,
+};
+
+#define KC_TRNS KC_TRANSPARENT
+#define XXXXXXX KC_NO
+#define _______ KC_TRNS
+#define KC_ENT KC_ENTER
+#define KC_ESC KC_ESCAPE
+#define KC_BSPC KC_BACKSPACE
+#define KC_SPC KC_SPACE
+#define KC_MINS KC_MINUS
+#define KC_EQL KC_EQUAL
+#define KC_LBRC KC_LEFT_BRACKET
+#define KC_RBRC KC_RIGHT_BRACKET
+#define KC_BSLS KC_BACKSLASH
+#define KC_NUHS KC_NONUS_HASH
+#define KC_SCLN KC_SEMICOLON
+#define KC_QUOT KC_QUOTE
+#define KC_GRV KC_GRAVE
+#define KC_COMM KC_COMMA
+#define KC_SLSH KC_SLASH
+#define KC_CAPS KC_CAPS_LOCK
+#define KC_PSCR KC_PRINT_SCREEN
+#define KC_SCRL KC_SCROLL_LOCK
+#define KC_PAUS KC_PAUSE
+#define KC_INS KC_INSERT
+#define KC_PGUP KC_PAGE_UP
+#define KC_DEL KC_DELETE
+#define KC_PGDN KC_PAGE_DOWN
+#define KC_RGHT KC_RIGHT
+#define KC_NUM KC_NUM_LOCK
+#define KC_PSLS KC_KP_SLASH
+#define KC_PAST KC_KP_ASTERISK
+#define KC_PMNS KC_KP_MINUS
+#define KC_PPLS KC_KP_PLUS
+#define KC_PENT KC_KP_ENTER
+#define KC_P1 KC_KP_1
+#define KC_P2 KC_KP_2
+#define KC_P3 KC_KP_3
+#define KC_P4 KC_KP_4
+#define KC_P5 KC_KP_5
+#define KC_P6 KC_KP_6
+#define KC_P7 KC_KP_7
+#define KC_P8 KC_KP_8
+#define KC_P9 KC_KP_9
+#define KC_P0 KC_KP_0
+#define KC_PDOT KC_KP_DOT
+#define KC_PEQL KC_KP_EQUAL
+#define KC_NUBS KC_NONUS_BACKSLASH
+#define KC_APP KC_APPLICATION
+#define KC_PWR KC_SYSTEM_POWER
+#define KC_MUTE KC_AUDIO_MUTE
+#define KC_VOLU KC_AUDIO_VOL_UP
+#define KC_VOLD KC_AUDIO_VOL_DOWN
+#define KC_MNXT KC_MEDIA_NEXT_TRACK
+#define KC_MPRV KC_MEDIA_PREV_TRACK
+#define KC_MSTP KC_MEDIA_STOP
+#define KC_MPLY KC_MEDIA_PLAY_PAUSE
+#define KC_EJCT KC_MEDIA_EJECT
+#define KC_WHOM KC_WWW_HOME
+#define KC_WBAK KC_WWW_BACK
+#define KC_WFWD KC_WWW_FORWARD
+#define KC_WSTP KC_WWW_STOP
+#define KC_WREF KC_WWW_REFRESH
+#define KC_MFFD KC_MEDIA_FAST_FORWARD
+#define KC_MRWD KC_MEDIA_REWIND
+#define KC_BRIU KC_BRIGHTNESS_UP
+#define KC_BRID KC_BRIGHTNESS_DOWN
+#define KC_LCTL KC_LEFT_CTRL
+#define KC_LSFT KC_LEFT_SHIFT
+#define KC_LALT KC_LEFT_ALT
+#define KC_LGUI KC_LEFT_GUI
+#define KC_RCTL KC_RIGHT_CTRL
+#define KC_RSFT KC_RIGHT_SHIFT
+#define KC_RALT KC_RIGHT_ALT
+#define KC_RGUI KC_RIGHT_GUI
+#define KC_MS_U MS_UP
+#define KC_MS_D MS_DOWN
+#define KC_MS_L MS_LEFT
+#define KC_MS_R MS_RGHT
+#define KC_WH_U MS_WHLU
+#define KC_WH_D MS_WHLD
+#define KC_WH_L MS_WHLL
+#define KC_WH_R MS_WHLR
+#define KC_BTN1 MS_BTN1
+#define KC_MS_BTN1 MS_BTN1
+#define QK_BOOT QK_BOOTLOADER
+#define DB_TOGG QK_DEBUG_TOGGLE
+#define EE_CLR QK_CLEAR_EEPROM
+#define QK_LEAD QK_LEADER
+#define QK_GESC QK_GRAVE_ESCAPE
+#define CW_TOGG QK_CAPS_WORD_TOGGLE
+#define QK_REP QK_REPEAT_KEY
+#define QK_AREP QK_ALT_REPEAT_KEY
+#define QK_LLCK QK_LAYER_LOCK
+
+#define MODIFIER_KEYCODE_RANGE KC_LEFT_CTRL ... KC_RIGHT_GUI
+#define KB_KEYCODE_RANGE QK_KB ... QK_KB_MAX
+#define USER_KEYCODE_RANGE QK_USER ... QK_USER_MAX
+#define IS_MODIFIER_KEYCODE(kc) \
+  ((kc) >= KC_LEFT_CTRL && (kc) <= KC_RIGHT_GUI)
+#define IS_MOUSE_KEYCODE(kc) ((kc) >= MS_UP && (kc) <= MS_ACL2)
+
+// 5-bit mods, as used in keycodes.
+enum mods_5bit {
+  MOD_LCTL = 0x01,
+  MOD_LSFT = 0x02,
+  MOD_LALT = 0x04,
+  MOD_LGUI = 0x08,
+  MOD_RCTL = 0x11,
+  MOD_RSFT = 0x12,
+  MOD_RALT = 0x14,
+  MOD_RGUI = 0x18,
+};
+#define MOD_HYPR (MOD_LCTL | MOD_LSFT | MOD_LALT | MOD_LGUI)
+#define MOD_MEH (MOD_LCTL | MOD_LSFT | MOD_LALT)
+
+// 8-bit mods, as used in the HID report.
+enum mods_8bit {
+  MOD_BIT_LCTRL = 0x01,
+  MOD_BIT_LSHIFT = 0x02,
+  MOD_BIT_LALT = 0x04,
+  MOD_BIT_LGUI = 0x08,
+  MOD_BIT_RCTRL = 0x10,
+  MOD_BIT_RSHIFT = 0x20,
+  MOD_BIT_RALT = 0x40,
+  MOD_BIT_RGUI = 0x80,
+};
+#define MOD_BIT(kc) ((uint8_t)(1 << ((kc) & 0x07)))
+#define MOD_MASK_CTRL (MOD_BIT_LCTRL | MOD_BIT_RCTRL)
+#define MOD_MASK_SHIFT (MOD_BIT_LSHIFT | MOD_BIT_RSHIFT)
+#define MOD_MASK_ALT (MOD_BIT_LALT | MOD_BIT_RALT)
+#define MOD_MASK_GUI (MOD_BIT_LGUI | MOD_BIT_RGUI)
+#define MOD_MASK_CS (MOD_MASK_CTRL | MOD_MASK_SHIFT)
+#define MOD_MASK_CA (MOD_MASK_CTRL | MOD_MASK_ALT)
+#define MOD_MASK_CG (MOD_MASK_CTRL | MOD_MASK_GUI)
+#define MOD_MASK_SA (MOD_MASK_SHIFT | MOD_MASK_ALT)
+#define MOD_MASK_SG (MOD_MASK_SHIFT | MOD_MASK_GUI)
+#define MOD_MASK_AG (MOD_MASK_ALT | MOD_MASK_GUI)
+#define MOD_MASK_CSAG (MOD_MASK_CS | MOD_MASK_AG)
+
+#define QK_LCTL 0x0100
+#define QK_LSFT 0x0200
+#define QK_LALT 0x0400
+#define QK_LGUI 0x0800
+#define QK_RMODS_MIN 0x1000
+#define QK_RCTL 0x1100
+#define QK_RSFT 0x1200
+#define QK_RALT 0x1400
+#define QK_RGUI 0x1800
+#define LCTL(kc) (QK_LCTL | (kc))
+#define LSFT(kc) (QK_LSFT | (kc))
+#define LALT(kc) (QK_LALT | (kc))
+#define LGUI(kc) (QK_LGUI | (kc))
+#define RCTL(kc) (QK_RCTL | (kc))
+#define RSFT(kc) (QK_RSFT | (kc))
+#define RALT(kc) (QK_RALT | (kc))
+#define RGUI(kc) (QK_RGUI | (kc))
+#define C(kc) LCTL(kc)
+#define S(kc) LSFT(kc)
+#define A(kc) LALT(kc)
+#define G(kc) LGUI(kc)
+#define HYPR(kc) (QK_LCTL | QK_LSFT | QK_LALT | QK_LGUI | (kc))
+#define MEH(kc) (QK_LCTL | QK_LSFT | QK_LALT | (kc))
+#define KC_HYPR HYPR(KC_NO)
+#define KC_MEH MEH(KC_NO)
+
+#define KC_TILD S(KC_GRV)
+#define KC_EXLM S(KC_1)
+#define KC_AT S(KC_2)
+#define KC_HASH S(KC_3)
+#define KC_DLR S(KC_4)
+#define KC_PERC S(KC_5)
+#define KC_CIRC S(KC_6)
+#define KC_AMPR S(KC_7)
+#define KC_ASTR S(KC_8)
+#define KC_LPRN S(KC_9)
+#define KC_RPRN S(KC_0)
+#define KC_UNDS S(KC_MINS)
+#define KC_PLUS S(KC_EQL)
+#define KC_LCBR S(KC_LBRC)
+#define KC_RCBR S(KC_RBRC)
+#define KC_PIPE S(KC_BSLS)
+#define KC_COLN S(KC_SCLN)
+#define KC_DQUO S(KC_QUOT)
+#define KC_LABK S(KC_COMM)
+#define KC_RABK S(KC_DOT)
+#define KC_QUES S(KC_SLSH)
+
+#define QK_MODS_GET_MODS(kc) (((kc) >> 8) & 0x1F)
+#define QK_MODS_GET_BASIC_KEYCODE(kc) ((kc) & 0xFF)
+#define MT(mod, kc) (QK_MOD_TAP | (((mod) & 0x1F) << 8) | ((kc) & 0xFF))
+#define QK_MOD_TAP_GET_MODS(kc) (((kc) >> 8) & 0x1F)
+#define QK_MOD_TAP_GET_TAP_KEYCODE(kc) ((kc) & 0xFF)
+#define LCTL_T(kc) MT(MOD_LCTL, kc)
+#define LSFT_T(kc) MT(MOD_LSFT, kc)
+#define LALT_T(kc) MT(MOD_LALT, kc)
+#define LGUI_T(kc) MT(MOD_LGUI, kc)
+#define RCTL_T(kc) MT(MOD_RCTL, kc)
+#define RSFT_T(kc) MT(MOD_RSFT, kc)
+#define RALT_T(kc) MT(MOD_RALT, kc)
+#define RGUI_T(kc) MT(MOD_RGUI, kc)
+#define LT(layer, kc) (QK_LAYER_TAP | (((layer) & 0xF) << 8) | ((kc) & 0xFF))
+#define QK_LAYER_TAP_GET_LAYER(kc) (((kc) >> 8) & 0xF)
+#define QK_LAYER_TAP_GET_TAP_KEYCODE(kc) ((kc) & 0xFF)
+#define LM(layer, mod) \
+  (QK_LAYER_MOD | (((layer) & 0xF) << 5) | ((mod) & 0x1F))
+#define QK_LAYER_MOD_GET_LAYER(kc) (((kc) >> 5) & 0xF)
+#define QK_LAYER_MOD_GET_MODS(kc) ((kc) & 0x1F)
+#define TO(layer) (QK_TO | ((layer) & 0x1F))
+#define QK_TO_GET_LAYER(kc) ((kc) & 0x1F)
+#define MO(layer) (QK_MOMENTARY | ((layer) & 0x1F))
+#define QK_MOMENTARY_GET_LAYER(kc) ((kc) & 0x1F)
+#define DF(layer) (QK_DEF_LAYER | ((layer) & 0x1F))
+#define QK_DEF_LAYER_GET_LAYER(kc) ((kc) & 0x1F)
+#define TG(layer) (QK_TOGGLE_LAYER | ((layer) & 0x1F))
+#define QK_TOGGLE_LAYER_GET_LAYER(kc) ((kc) & 0x1F)
+#define OSL(layer) (QK_ONE_SHOT_LAYER | ((layer) & 0x1F))
+#define QK_ONE_SHOT_LAYER_GET_LAYER(kc) ((kc) & 0x1F)
+#define OSM(mod) (QK_ONE_SHOT_MOD | ((mod) & 0x1F))
+#define QK_ONE_SHOT_MOD_GET_MODS(kc) ((kc) & 0x1F)
+#define TT(layer) (QK_LAYER_TAP_TOGGLE | ((layer) & 0x1F))
+#define QK_LAYER_TAP_TOGGLE_GET_LAYER(kc) ((kc) & 0x1F)
+#define PDF(layer) (QK_PERSISTENT_DEF_LAYER | ((layer) & 0x1F))
+#define QK_PERSISTENT_DEF_LAYER_GET_LAYER(kc) ((kc) & 0x1F)
+#define TD(i) (QK_TAP_DANCE | ((i) & 0xFF))
+#define QK_TAP_DANCE_GET_INDEX(kc) ((kc) & 0xFF)
+#define UC(c) (QK_UNICODE | ((c) & 0x7FFF))
+#define QK_UNICODE_GET_CODE_POINT(kc) ((kc) & 0x7FFF)
+
+#define IS_QK_BASIC(kc) ((kc) <= QK_BASIC_MAX)
+#define IS_QK_MODS(kc) ((kc) >= QK_MODS && (kc) <= QK_MODS_MAX)
+#define IS_QK_MOD_TAP(kc) ((kc) >= QK_MOD_TAP && (kc) <= QK_MOD_TAP_MAX)
+#define IS_QK_LAYER_TAP(kc) \
+  ((kc) >= QK_LAYER_TAP && (kc) <= QK_LAYER_TAP_MAX)
+#define IS_QK_ONE_SHOT_MOD(kc) \
+  ((kc) >= QK_ONE_SHOT_MOD && (kc) <= QK_ONE_SHOT_MOD_MAX)
+// clang-format on
+
+///////////////////////////////////////////////////////////////////////////////
+// Events and records
+///////////////////////////////////////////////////////////////////////////////
+typedef struct {
+  uint8_t col;
+  uint8_t row;
+} keypos_t;
+
+// Bitmap of a matrix row, one bit per column.
+#if MATRIX_COLS <= 8
+typedef uint8_t matrix_row_t;
+#elif MATRIX_COLS <= 16
+typedef uint16_t matrix_row_t;
+#else
+typedef uint32_t matrix_row_t;
+#endif
+
+typedef enum {
+  TICK_EVENT = 0,
+  KEY_EVENT = 1,
+  ENCODER_CW_EVENT = 2,
+  ENCODER_CCW_EVENT = 3,
+  COMBO_EVENT = 4,
+} keyevent_type_t;
+
+typedef struct {
+  keypos_t key;
+  uint16_t time;
+  keyevent_type_t type;
+  bool pressed;
+} keyevent_t;
+
+typedef struct {
+  bool interrupted : 1;
+  bool reserved2 : 1;
+  bool reserved1 : 1;
+  bool reserved0 : 1;
+  uint8_t count : 4;
+} tap_t;
+
+typedef struct {
+  keyevent_t event;
+  tap_t tap;
+  uint16_t keycode;
+} keyrecord_t;
+
+#define IS_KEYEVENT(event) ((event).type == KEY_EVENT)
+#define IS_COMBOEVENT(event) ((event).type == COMBO_EVENT)
+#define KEYEQ(keya, keyb) \
+  ((keya).row == (keyb).row && (keya).col == (keyb).col)
+#define MAKE_KEYEVENT(row_num, col_num, press)                \
+  ((keyevent_t){.key = (keypos_t){.row = (row_num), .col = (col_num)}, \
+                .pressed = (press),                                    \
+                .time = (uint16_t)(timer_read() | 1),                 \
+                .type = KEY_EVENT})
+
+typedef union {
+  uint16_t code;
+} action_t;
+
+#define ACTION_MODS(mods) ((uint16_t)(0x0000 | (((mods) & 0x1F) << 8)))
+#define ACTION_MODS_TAP_KEY(mods, key) \
+  ((uint16_t)(0x2000 | (((mods) & 0x1F) << 8) | ((key) & 0xFF)))
+
+typedef struct {
+  const uint16_t* keys;
+  uint16_t keycode;
+} combo_t;
+#define COMBO_END 0
+#define COMBO(ck, ca) {.keys = &(ck)[0], .keycode = (ca)}
+
+///////////////////////////////////////////////////////////////////////////////
+// Timer
+///////////////////////////////////////////////////////////////////////////////
+uint16_t timer_read(void);
+uint32_t timer_read32(void);
+uint16_t timer_elapsed(uint16_t last);
+uint32_t timer_elapsed32(uint32_t last);
+#define timer_expired(current, future) \
+  ((uint16_t)((uint16_t)(current) - (uint16_t)(future)) < UINT16_MAX / 2)
+#define timer_expired32(current, future) \
+  ((uint32_t)((uint32_t)(current) - (uint32_t)(future)) < UINT32_MAX / 2)
+#define TIMER_DIFF_16(a, b) ((uint16_t)((uint16_t)(a) - (uint16_t)(b)))
+void wait_ms(uint32_t ms);
+
+///////////////////////////////////////////////////////////////////////////////
+// Reports, mods, and keys
+///////////////////////////////////////////////////////////////////////////////
+typedef struct {
+  uint8_t buttons;
+  int8_t x;
+  int8_t y;
+  int8_t v;
+  int8_t h;
+} report_mouse_t;
+
+void send_keyboard_report(void);
+void host_mouse_send(report_mouse_t* report);
+
+uint8_t get_mods(void);
+void add_mods(uint8_t mods);
+void del_mods(uint8_t mods);
+void set_mods(uint8_t mods);
+void clear_mods(void);
+void register_mods(uint8_t mods);
+void unregister_mods(uint8_t mods);
+uint8_t get_weak_mods(void);
+void add_weak_mods(uint8_t mods);
+void del_weak_mods(uint8_t mods);
+void set_weak_mods(uint8_t mods);
+void clear_weak_mods(void);
+void register_weak_mods(uint8_t mods);
+void unregister_weak_mods(uint8_t mods);
+uint8_t get_oneshot_mods(void);
+void add_oneshot_mods(uint8_t mods);
+void del_oneshot_mods(uint8_t mods);
+void set_oneshot_mods(uint8_t mods);
+void clear_oneshot_mods(void);
+/** Applies keymap mod config (e.g. swapped Alt and GUI) to 5-bit mods. */
+uint8_t mod_config(uint8_t mods);
+
+void add_key(uint8_t keycode);
+void del_key(uint8_t keycode);
+void register_code(uint8_t keycode);
+void unregister_code(uint8_t keycode);
+void register_code16(uint16_t keycode);
+void unregister_code16(uint16_t keycode);
+void tap_code_delay(uint8_t keycode, uint16_t delay);
+void tap_code16_delay(uint16_t keycode, uint16_t delay);
+#define tap_code(kc) \
+  tap_code_delay(kc, (kc) == KC_CAPS ? TAP_HOLD_CAPS_DELAY : TAP_CODE_DELAY)
+#define tap_code16(kc) \
+  tap_code16_delay(kc, (kc) == KC_CAPS ? TAP_HOLD_CAPS_DELAY : TAP_CODE_DELAY)
+
+///////////////////////////////////////////////////////////////////////////////
+// Send string
+///////////////////////////////////////////////////////////////////////////////
+#define SS_QMK_PREFIX 1
+#define SS_TAP_CODE 1
+#define SS_DOWN_CODE 2
+#define SS_UP_CODE 3
+#define SS_DELAY_CODE 4
+#define SS_TAP(keycode) "\1\1" keycode
+#define SS_DOWN(keycode) "\1\2" keycode
+#define SS_UP(keycode) "\1\3" keycode
+#define SS_DELAY(msecs) "\1\4" #msecs "|"
+#define SS_LCTL(string) SS_DOWN(X_LCTL) string SS_UP(X_LCTL)
+#define SS_LSFT(string) SS_DOWN(X_LSFT) string SS_UP(X_LSFT)
+#define SS_LALT(string) SS_DOWN(X_LALT) string SS_UP(X_LALT)
+#define SS_LGUI(string) SS_DOWN(X_LGUI) string SS_UP(X_LGUI)
+#define X_BSPC "\x2a"
+#define X_END "\x4d"
+#define X_HOME "\x4a"
+#define X_RGHT "\x4f"
+#define X_LEFT "\x50"
+#define X_DOWN "\x51"
+#define X_UP "\x52"
+#define X_LCTL "\xe0"
+#define X_LSFT "\xe1"
+#define X_LALT "\xe2"
+#define X_LGUI "\xe3"
+
+extern const uint8_t ascii_to_shift_lut[16];
+extern const uint8_t ascii_to_keycode_lut[128];
+
+void send_char(char ascii_code);
+void send_string(const char* str);
+void send_string_with_delay(const char* str, uint8_t interval);
+#define send_string_P send_string
+#define send_string_with_delay_P send_string_with_delay
+#define SEND_STRING(string) send_string(string)
+
+///////////////////////////////////////////////////////////////////////////////
+// Layers
+///////////////////////////////////////////////////////////////////////////////
+typedef uint32_t layer_state_t;
+extern layer_state_t layer_state;
+extern layer_state_t default_layer_state;
+void layer_on(uint8_t layer);
+void layer_off(uint8_t layer);
+void layer_move(uint8_t layer);
+void layer_invert(uint8_t layer);
+void layer_and(layer_state_t state);
+void layer_or(layer_state_t state);
+void layer_clear(void);
+uint8_t get_highest_layer(layer_state_t state);
+#define IS_LAYER_ON(layer) ((layer_state & ((layer_state_t)1 << (layer))) != 0)
+#define IS_LAYER_ON_STATE(state, layer) \
+  (((state) & ((layer_state_t)1 << (layer))) != 0)
+uint8_t read_source_layers_cache(keypos_t key);
+uint8_t get_oneshot_layer(void);
+void reset_oneshot_layer(void);
+layer_state_t layer_state_set_user(layer_state_t state);
+
+uint16_t keymap_key_to_keycode(uint8_t layer, keypos_t key);
+/** Number of layers in `keymaps`, defined by the keymap. */
+uint8_t keymap_layer_count(void);
+/**
+ * Keycode bound at `key` in the simulator only, in place of the one in
+ * `keymaps`, or KC_NO if none. Defined by the keymap glue.
+ */
+uint16_t keymap_sim_keycode(uint8_t layer, keypos_t key);
+extern const uint16_t keymaps[][MATRIX_ROWS][MATRIX_COLS];
+
+///////////////////////////////////////////////////////////////////////////////
+// Event processing
+///////////////////////////////////////////////////////////////////////////////
+void process_record(keyrecord_t* record);
+void process_action(keyrecord_t* record, action_t action);
+/** Handler chain for libraries, defined by the keymap glue. */
+bool process_record_modules(uint16_t keycode, keyrecord_t* record);
+bool pre_process_record_user(uint16_t keycode, keyrecord_t* record);
+bool process_record_user(uint16_t keycode, keyrecord_t* record);
+void post_process_record_user(uint16_t keycode, keyrecord_t* record);
+/** Task functions for libraries, defined by the keymap glue. */
+void housekeeping_task_modules(void);
+void housekeeping_task_user(void);
+void keyboard_post_init_user(void);
+
+uint16_t get_tapping_term(uint16_t keycode, keyrecord_t* record);
+uint16_t get_quick_tap_term(uint16_t keycode, keyrecord_t* record);
+#ifdef CHORDAL_HOLD
+extern const char chordal_hold_layout[MATRIX_ROWS][MATRIX_COLS] PROGMEM;
+char chordal_hold_handedness(keypos_t key);
+bool get_chordal_hold(uint16_t tap_hold_keycode, keyrecord_t* tap_hold_record,
+                      uint16_t other_keycode, keyrecord_t* other_record);
+bool get_chordal_hold_default(keyrecord_t* tap_hold_record,
+                              keyrecord_t* other_record);
+#endif  // CHORDAL_HOLD
+
+///////////////////////////////////////////////////////////////////////////////
+// Deferred execution
+///////////////////////////////////////////////////////////////////////////////
+typedef uint8_t deferred_token;
+typedef uint32_t (*deferred_exec_callback)(uint32_t trigger_time,
+                                           void* cb_arg);
+#define INVALID_DEFERRED_TOKEN 0
+deferred_token defer_exec(uint32_t delay_ms, deferred_exec_callback callback,
+                          void* cb_arg);
+bool extend_deferred_exec(deferred_token token, uint32_t delay_ms);
+bool cancel_deferred_exec(deferred_token token);
+
+///////////////////////////////////////////////////////////////////////////////
+// Debug and console
+///////////////////////////////////////////////////////////////////////////////
+extern bool debug_enable;
+#define xprintf(...) fprintf(stderr, __VA_ARGS__)
+#define uprintf(...) fprintf(stderr, __VA_ARGS__)
+#ifdef NO_DEBUG
+#define dprintf(...) \
+  do {               \
+  } while (0)
+#define dprintln(s) \
+  do {              \
+  } while (0)
+#else
+#define dprintf(...)             \
+  do {                           \
+    if (debug_enable) {          \
+      xprintf(__VA_ARGS__);      \
+    }                            \
+  } while (0)
+#define dprintln(s) dprintf("%s\n", s)
+#endif  // NO_DEBUG
+
+#ifdef __cplusplus
+}
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+// Core features and community modules
+///////////////////////////////////////////////////////////////////////////////
+// The userspace libraries under features/ stand in for the QMK core features
+// and community modules that the firmware build would otherwise provide.
+#include "features/achordion.h"
+#include "features/autocorrection.h"
+#include "features/caps_word.h"
+#include "features/custom_shift_keys.h"
+#include "features/deadlines.h"
+#include "features/event_log.h"
+#include "features/handler_profiler.h"
+#include "features/key_context.h"
+#include "features/keycode_class.h"
+#include "features/keycode_string.h"
+#include "features/latency_tracer.h"
+#include "features/layer_lock.h"
+#include "features/orbital_mouse.h"
+#include "features/output_queue.h"
+#include "features/repeat_key.h"
+#include "features/select_word.h"
+#include "features/sentence_case.h"
+#include "features/socd_cleaner.h"
+#include "features/typing_speed.h"
+
+// Keycodes of the Select Word community module, which features/select_word.c
+// leaves to the keymap to define.
+enum select_word_keycodes {
+  SELWORD = QK_KB_0,
+  SELWBAK,
+  SELLINE,
+};
@@ -0,0 +1,188 @@
+// Copyright 2026 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file replay.c
+ * @brief Replays a key event trace through the simulated keymap.
+ *
+ * Usage:
+ *
+ *     replay [-d] [--bench N] trace_file
+ *
+ * A trace is a text file with one event per line,
+ *
+ *     <time ms> down <row> <col>
+ *     <time ms> up <row> <col>
+ *     <time ms> idle
+ *
+ * where "idle" runs the main loop until the given time without an event.
+ * Blank lines and lines starting with '#' are ignored. Times must be
+ * nondecreasing. Each HID report is printed to stdout as
+ *
+ *     <time ms> kbd <mods> [<key> ...]
+ *     <time ms> mouse <buttons> <x> <y> <v> <h>
+ *
+ * with mods and keys in hex. With `-d`, debug_enable is set, so that debug
+ * logging from the keymap goes to stderr. With `--bench N`, the trace is
+ * replayed N times without printing reports, and the host time per event is
+ * printed instead. When built with Handler Profiler or Latency Tracer
+ * enabled, their stats are printed to stderr at the end.
+ */
+
+#include <stdlib.h>
+#include <time.h>
+
+#include "qmk_sim.h"
+
+typedef struct {
+  uint32_t time;
+  uint8_t row;
+  uint8_t col;
+  // 1 = press, 0 = release, -1 = idle.
+  int8_t action;
+} trace_event_t;
+
+static trace_event_t* events = NULL;
+static size_t num_events = 0;
+
+static void print_report(const sim_report_t* report) {
+  if (report->type == SIM_REPORT_KEYBOARD) {
+    printf("%6u kbd %02x", report->time, report->mods);
+    for (int i = 0; i < 6; ++i) {
+      if (report->keys[i]) {
+        printf(" %02x", report->keys[i]);
+      }
+    }
+    printf("\n");
+  } else {
+    printf("%6u mouse %02x %d %d %d %d\n", report->time,
+           report->mouse.buttons, report->mouse.x, report->mouse.y,
+           report->mouse.v, report->mouse.h);
+  }
+}
+
+static bool load_trace(const char* filename) {
+  FILE* fp = fopen(filename, "r");
+  if (!fp) {
+    fprintf(stderr, "Error: failed to open \"%s\"\n", filename);
+    return false;
+  }
+
+  size_t capacity = 0;
+  char line[256];
+  int line_number = 0;
+  uint32_t last_time = 0;
+  while (fgets(line, sizeof(line), fp)) {
+    ++line_number;
+    char* p = line;
+    while (*p == ' ' || *p == '\t') {
+      ++p;
+    }
+    if (*p == '#' || *p == '\n' || *p == '\r' || !*p) {
+      continue;
+    }
+
+    trace_event_t event = {0};
+    char action[8];
+    unsigned time, row = 0, col = 0;
+    const int n = sscanf(p, "%u %7s %u %u", &time, action, &row, &col);
+    if (n >= 2 && !strcmp(action, "idle")) {
+      event.action = -1;
+    } else if (n == 4 && (!strcmp(action, "down") || !strcmp(action, "up")) &&
+               row < MATRIX_ROWS && col < MATRIX_COLS) {
+      event.action = !strcmp(action, "down");
+    } else {
+      fprintf(stderr, "Error: %s:%d: invalid event\n", filename, line_number);
+      fclose(fp);
+      return false;
+    }
+    if (time < last_time) {
+      fprintf(stderr, "Error: %s:%d: time goes backward\n", filename,
+              line_number);
+      fclose(fp);
+      return false;
+    }
+    last_time = event.time = time;
+    event.row = row;
+    event.col = col;
+
+    if (num_events == capacity) {
+      capacity = capacity ? 2 * capacity : 64;
+      events = realloc(events, capacity * sizeof(trace_event_t));
+    }
+    events[num_events++] = event;
+  }
+
+  fclose(fp);
+  return true;
+}
+
+static void replay(void) {
+  sim_init();
+  for (size_t i = 0; i < num_events; ++i) {
+    sim_run_until(events[i].time);
+    if (events[i].action >= 0) {
+      sim_key_event(events[i].row, events[i].col, events[i].action);
+    }
+  }
+}
+
+int main(int argc, char** argv) {
+  const char* filename = NULL;
+  long bench_iterations = 0;
+
+  for (int i = 1; i < argc; ++i) {
+    if (!strcmp(argv[i], "-d")) {
+      debug_enable = true;
+    } else if (!strcmp(argv[i], "--bench") && i + 1 < argc) {
+      bench_iterations = strtol(argv[++i], NULL, 10);
+    } else if (!filename && argv[i][0] != '-') {
+      filename = argv[i];
+    } else {
+      filename = NULL;
+      break;
+    }
+  }
+  if (!filename) {
+    fprintf(stderr, "Usage: %s [-d] [--bench N] trace_file\n", argv[0]);
+    return 1;
+  }
+  if (!load_trace(filename)) {
+    return 1;
+  }
+
+  if (bench_iterations <= 0) {
+    sim_set_report_callback(print_report);
+    replay();
+  } else {
+    struct timespec start, end;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (long i = 0; i < bench_iterations; ++i) {
+      replay();
+    }
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    const double elapsed_ns =
+        1e9 * (end.tv_sec - start.tv_sec) + (end.tv_nsec - start.tv_nsec);
+    printf("%ld iterations of %zu events: %.1f ns/event\n", bench_iterations,
+           num_events, elapsed_ns / (bench_iterations * (double)num_events));
+  }
+
+  handler_profiler_report();
+  latency_tracer_report();
+  if (debug_enable) {
+    typing_speed_report();
+  }
+  free(events);
+  return 0;
+}